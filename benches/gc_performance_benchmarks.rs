@@ -1,5 +1,7 @@
-use criterion::{Criterion, black_box, criterion_group, criterion_main};
-use python_gc::{GarbageCollector, PyObject, object::ObjectData};
+use criterion::{Criterion, Throughput, black_box, criterion_group, criterion_main};
+use python_gc::traversal::{ObjectGraph, ReferenceType};
+use python_gc::{GarbageCollector, PyObject, gc::global, object::ObjectData, object::ObjectId};
+use std::sync::{Arc, Barrier};
 
 fn create_test_objects(count: usize) -> Vec<PyObject> {
     static NAMES: [&str; 3] = ["list", "dict", "set"];
@@ -215,6 +217,278 @@ fn benchmark_python_object_tracking(c: &mut Criterion) {
     group.finish();
 }
 
+/// Contention gate for the shared `gc::global` instance. The single-threaded
+/// groups above each build a private `GarbageCollector`, so the RwLock and
+/// shard-routing costs that dominate production profiles never show up there.
+/// Here 2/8/32 threads hammer the global collector with mixed
+/// track/untrack/collect traffic; element throughput is the aggregate op
+/// rate, so Criterion's per-element time is the per-op latency.
+fn benchmark_global_contention(c: &mut Criterion) {
+    const OPS_PER_THREAD: usize = 1000;
+
+    let mut group = c.benchmark_group("Global GC Contention");
+
+    for &threads in &[2usize, 8, 32] {
+        group.throughput(Throughput::Elements((threads * OPS_PER_THREAD) as u64));
+        group.bench_function(format!("track_untrack_collect_{threads}_threads"), |b| {
+            b.iter(|| {
+                let barrier = Arc::new(Barrier::new(threads));
+
+                let handles: Vec<_> = (0..threads)
+                    .map(|worker| {
+                        let barrier = Arc::clone(&barrier);
+                        std::thread::spawn(move || {
+                            barrier.wait();
+
+                            // Most objects untrack immediately; a few linger so
+                            // the periodic collect has live state to walk. The
+                            // leftovers untrack at the end to keep iterations
+                            // independent.
+                            let mut leftovers = Vec::new();
+                            for i in 0..OPS_PER_THREAD {
+                                let obj = PyObject::new(
+                                    "contended".to_string(),
+                                    ObjectData::Integer(i as i64),
+                                );
+                                let obj_id = obj.id;
+                                global::track(obj).unwrap();
+
+                                if i % 4 == 0 {
+                                    leftovers.push(obj_id);
+                                } else {
+                                    global::untrack(&obj_id).unwrap();
+                                }
+
+                                if worker == 0 && i % 256 == 0 {
+                                    global::collect().unwrap();
+                                }
+                            }
+
+                            for obj_id in leftovers {
+                                let _ = global::untrack(&obj_id);
+                            }
+                        })
+                    })
+                    .collect();
+
+                for handle in handles {
+                    handle.join().unwrap();
+                }
+
+                black_box(global::get_stats());
+            });
+        });
+    }
+
+    group.finish();
+}
+
+/// Deterministic generator for the random-graph shapes; no external RNG
+/// dependency, same corpus every run.
+struct Lcg(u64);
+
+impl Lcg {
+    fn next(&mut self) -> u64 {
+        self.0 = self
+            .0
+            .wrapping_mul(6364136223846793005)
+            .wrapping_add(1442695040888963407);
+        self.0
+    }
+
+    fn below(&mut self, bound: usize) -> usize {
+        (self.next() % bound as u64) as usize
+    }
+}
+
+fn graph_with_nodes(count: usize) -> (ObjectGraph, Vec<ObjectId>) {
+    let mut graph = ObjectGraph::new();
+    let ids = (0..count)
+        .map(|i| {
+            let obj = PyObject::new("node".to_string(), ObjectData::Integer(i as i64));
+            let id = obj.id;
+            graph.add_object(obj);
+            id
+        })
+        .collect();
+    (graph, ids)
+}
+
+/// A single path of `len` nodes: worst case for recursive traversals and the
+/// reason `find_reachable`/`detect_cycles` are iterative.
+fn deep_chain(len: usize) -> (ObjectGraph, Vec<ObjectId>) {
+    let (mut graph, ids) = graph_with_nodes(len);
+    for pair in ids.windows(2) {
+        graph
+            .add_reference(pair[0], pair[1], ReferenceType::Direct)
+            .unwrap();
+    }
+    (graph, ids)
+}
+
+/// One root referencing every other node: stresses the frontier queue and
+/// the per-node edge-list lookup.
+fn wide_fanout(total: usize) -> (ObjectGraph, Vec<ObjectId>) {
+    let (mut graph, ids) = graph_with_nodes(total);
+    for &child in &ids[1..] {
+        graph
+            .add_reference(ids[0], child, ReferenceType::Direct)
+            .unwrap();
+    }
+    (graph, ids)
+}
+
+/// Dense strongly connected components: nodes partition into groups of
+/// `scc_size`, each group a complete digraph, adjacent groups bridged so the
+/// whole heap is one weakly connected object graph.
+fn scc_mesh(total: usize, scc_size: usize) -> (ObjectGraph, Vec<ObjectId>) {
+    let (mut graph, ids) = graph_with_nodes(total);
+    for group in ids.chunks(scc_size) {
+        for &from in group {
+            for &to in group {
+                if from != to {
+                    graph.add_reference(from, to, ReferenceType::Direct).unwrap();
+                }
+            }
+        }
+    }
+    for pair in ids.chunks(scc_size).collect::<Vec<_>>().windows(2) {
+        graph
+            .add_reference(pair[0][0], pair[1][0], ReferenceType::Direct)
+            .unwrap();
+    }
+    (graph, ids)
+}
+
+/// Random graph with `out_degree` edges per node. Forward edges keep the
+/// graph acyclic; with probability `cycle_density` an edge points backwards
+/// instead, so the knob tunes how much cycle structure Tarjan has to unwind.
+fn random_graph(
+    total: usize,
+    out_degree: usize,
+    cycle_density: f64,
+    seed: u64,
+) -> (ObjectGraph, Vec<ObjectId>) {
+    let (mut graph, ids) = graph_with_nodes(total);
+    let mut rng = Lcg(seed);
+    let back_threshold = (cycle_density * u32::MAX as f64) as u64;
+
+    for (i, &from) in ids.iter().enumerate() {
+        for _ in 0..out_degree {
+            let backwards = (rng.next() & u32::MAX as u64) < back_threshold;
+            let to = if backwards && i > 0 {
+                ids[rng.below(i)]
+            } else if i + 1 < total {
+                ids[i + 1 + rng.below(total - i - 1)]
+            } else {
+                continue;
+            };
+            graph.add_reference(from, to, ReferenceType::Direct).unwrap();
+        }
+    }
+    (graph, ids)
+}
+
+/// Replay a whitespace-separated `from to` edge-list file (one edge per
+/// line, `#` comments), e.g. exported from a production heap snapshot.
+/// Node indices are dense; objects are allocated on first sight.
+fn load_edge_list(path: &str) -> std::io::Result<(ObjectGraph, Vec<ObjectId>)> {
+    use std::collections::HashMap;
+
+    let mut graph = ObjectGraph::new();
+    let mut ids: Vec<ObjectId> = Vec::new();
+    let mut index: HashMap<usize, ObjectId> = HashMap::new();
+
+    let intern = |graph: &mut ObjectGraph,
+                      ids: &mut Vec<ObjectId>,
+                      index: &mut HashMap<usize, ObjectId>,
+                      node: usize| {
+        *index.entry(node).or_insert_with(|| {
+            let obj = PyObject::new("node".to_string(), ObjectData::Integer(node as i64));
+            let id = obj.id;
+            graph.add_object(obj);
+            ids.push(id);
+            id
+        })
+    };
+
+    for line in std::fs::read_to_string(path)?.lines() {
+        let line = line.trim();
+        if line.is_empty() || line.starts_with('#') {
+            continue;
+        }
+        let mut fields = line.split_whitespace();
+        let (Some(from), Some(to)) = (fields.next(), fields.next()) else {
+            continue;
+        };
+        let (Ok(from), Ok(to)) = (from.parse::<usize>(), to.parse::<usize>()) else {
+            continue;
+        };
+        let from = intern(&mut graph, &mut ids, &mut index, from);
+        let to = intern(&mut graph, &mut ids, &mut index, to);
+        graph
+            .add_reference(from, to, ReferenceType::Direct)
+            .expect("both endpoints interned above");
+    }
+
+    Ok((graph, ids))
+}
+
+/// Traversal and cycle-detection coverage on generated pathological shapes.
+/// Graphs build once per shape outside the timed loop; sizes top out at 10^6
+/// nodes so the full suite still finishes in reasonable wall time — every
+/// shape scales linearly if a larger corpus is wanted. Set
+/// `GC_BENCH_EDGE_LIST=<path>` to additionally replay a captured edge-list
+/// file through the same measurements.
+fn benchmark_pathological_graphs(c: &mut Criterion) {
+    let mut group = c.benchmark_group("Pathological Graphs");
+    group.sample_size(10);
+
+    for &len in &[100_000usize, 1_000_000] {
+        let (graph, ids) = deep_chain(len);
+        group.bench_function(format!("find_reachable_chain_{len}"), |b| {
+            b.iter(|| black_box(graph.find_reachable(&ids[..1])));
+        });
+    }
+
+    for &total in &[100_000usize, 1_000_000] {
+        let (graph, ids) = wide_fanout(total);
+        group.bench_function(format!("find_reachable_fanout_{total}"), |b| {
+            b.iter(|| black_box(graph.find_reachable(&ids[..1])));
+        });
+    }
+
+    let (graph, ids) = scc_mesh(100_000, 16);
+    group.bench_function("find_reachable_scc_mesh_100000", |b| {
+        b.iter(|| black_box(graph.find_reachable(&ids[..1])));
+    });
+    group.bench_function("detect_cycles_scc_mesh_100000", |b| {
+        b.iter(|| black_box(graph.detect_cycles()));
+    });
+
+    for &density in &[0.0f64, 0.1, 0.5] {
+        let (graph, _) = random_graph(100_000, 4, density, 0x5eed);
+        group.bench_function(
+            format!("detect_cycles_random_100000_density_{density}"),
+            |b| {
+                b.iter(|| black_box(graph.detect_cycles()));
+            },
+        );
+    }
+
+    if let Ok(path) = std::env::var("GC_BENCH_EDGE_LIST") {
+        let (graph, ids) = load_edge_list(&path).expect("readable edge-list file");
+        group.bench_function("find_reachable_edge_list_replay", |b| {
+            b.iter(|| black_box(graph.find_reachable(&ids[..1])));
+        });
+        group.bench_function("detect_cycles_edge_list_replay", |b| {
+            b.iter(|| black_box(graph.detect_cycles()));
+        });
+    }
+
+    group.finish();
+}
+
 criterion_group!(
     benches,
     benchmark_object_creation,
@@ -222,7 +496,9 @@ criterion_group!(
     benchmark_garbage_collection,
     benchmark_generation_management,
     benchmark_memory_usage,
-    benchmark_python_object_tracking
+    benchmark_python_object_tracking,
+    benchmark_global_contention,
+    benchmark_pathological_graphs
 );
 
 criterion_main!(benches);
@@ -24,6 +24,24 @@ typedef struct {
     int32_t uncollectable;
 } gc_stats_t;
 
+// Number of power-of-two pause histogram buckets in gc_stats_v2_t
+#define GC_PAUSE_BUCKET_COUNT 16
+
+// Extended GC statistics: per-generation counters plus pause histogram.
+// Bucket i counts collections that paused for [2^(i-1), 2^i) microseconds,
+// with the last bucket absorbing the tail.
+typedef struct {
+    uint64_t collections[3];
+    uint64_t collected[3];
+    uint64_t promotions[3];
+    uint64_t pause_buckets[GC_PAUSE_BUCKET_COUNT];
+    uint64_t total_pause_us;
+    uint64_t max_pause_us;
+    int32_t total_tracked;
+    int32_t generation_counts[3];
+    int32_t uncollectable;
+} gc_stats_v2_t;
+
 // Core GC Management Functions
 
 /**
@@ -107,6 +125,16 @@ gc_return_code_t py_gc_object_destroyed(void* obj_ptr);
  */
 gc_return_code_t py_gc_refcount_changed(void* obj_ptr, int32_t old_count, int32_t new_count);
 
+/**
+ * Drain the calling thread's buffered refcount deltas into the registry.
+ * py_gc_refcount_changed buffers (pointer, delta) pairs in a thread-local
+ * ring and only touches the registry when the ring fills, at collection
+ * start, or on this explicit flush; callbacks observe the per-object
+ * aggregate.
+ * @return Number of distinct objects whose refcount was updated
+ */
+int32_t py_gc_flush_refcount_deltas(void);
+
 // Manual Object Tracking
 
 /**
@@ -123,6 +151,24 @@ gc_return_code_t py_gc_track(void* obj_ptr);
  */
 gc_return_code_t py_gc_untrack(void* obj_ptr);
 
+/**
+ * Track an array of objects with a single boundary crossing.
+ * NULL entries and already-tracked pointers are skipped.
+ * @param objs Array of object pointers
+ * @param count Number of entries in the array
+ * @return Number of objects newly tracked, or -1 on invalid arguments
+ */
+int32_t py_gc_track_batch(void** objs, size_t count);
+
+/**
+ * Untrack an array of objects with a single boundary crossing.
+ * NULL entries and untracked pointers are skipped.
+ * @param objs Array of object pointers
+ * @param count Number of entries in the array
+ * @return Number of objects untracked, or -1 on invalid arguments
+ */
+int32_t py_gc_untrack_batch(void** objs, size_t count);
+
 /**
  * Check if an object is tracked by the garbage collector
  * @param obj_ptr Pointer to the Python object
@@ -185,6 +231,41 @@ gc_return_code_t py_gc_collect_generation(int32_t generation);
  */
 gc_return_code_t py_gc_collect(void);
 
+/**
+ * Perform a cycle collection driven by tp_traverse callbacks.
+ * Discovers edges by traversing each tracked object's type slot instead of
+ * the manual reference map; objects unreachable from externally referenced
+ * roots are cleared via tp_clear and untracked. Only valid for objects
+ * registered through the automatic tracking hooks.
+ * @return Number of objects collected, or -1 if GC is not initialized
+ */
+int32_t py_gc_collect_traverse(void);
+
+/**
+ * Start dedicated background collector threads.
+ * The threads watch the generation thresholds and collect in short
+ * incremental slices off the calling thread's path.
+ * @param threads Number of collector threads (clamped to the shard count)
+ * @return GC_SUCCESS on success, error code if already running or on failure
+ */
+gc_return_code_t py_gc_start_background_collector(int32_t threads);
+
+/**
+ * Stop the background collector threads and wait for them to exit.
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_stop_background_collector(void);
+
+/**
+ * Perform incremental collection bounded by a time budget.
+ * Runs bounded slices of collection work and yields internal locks between
+ * slices so concurrent tracking is not stalled for a full cycle; a cycle cut
+ * short by the budget resumes on the next call.
+ * @param budget_us Time budget in microseconds
+ * @return Number of objects collected within the budget, or -1 on error
+ */
+int32_t py_gc_collect_budget_us(uint64_t budget_us);
+
 /**
  * Check if collection is needed
  * @return 1 if collection is needed, 0 if not
@@ -206,6 +287,108 @@ gc_return_code_t py_gc_collect_if_needed(void);
  */
 gc_return_code_t py_gc_get_stats(gc_stats_t* stats);
 
+/**
+ * Get extended garbage collection statistics, including per-generation
+ * collection/promotion counters and pause-time histograms. The counters are
+ * maintained with relaxed atomics and are cheap enough to leave on always.
+ * @param stats Pointer to gc_stats_v2_t structure to fill
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_get_stats_v2(gc_stats_v2_t* stats);
+
+// Layout of the shared-memory stats segment published by
+// py_gc_stats_shm_open. seq is a seqlock generation counter: odd while an
+// update is in flight. Reader protocol: load seq (retry while odd), copy the
+// counters, reload seq, and retry if it changed.
+typedef struct {
+    uint64_t seq;
+    uint64_t collections[3];
+    uint64_t collected[3];
+    uint64_t promotions[3];
+    uint64_t pause_buckets[GC_PAUSE_BUCKET_COUNT];
+    uint64_t total_pause_us;
+    uint64_t max_pause_us;
+} gc_stats_shm_t;
+
+/**
+ * Open (creating if needed) a named POSIX shared-memory segment laid out as
+ * gc_stats_shm_t and mirror the telemetry counters into it after every
+ * collection. External processes mmap the segment and scrape it with the
+ * seqlock protocol above, without taking any GC lock.
+ * @param name POSIX shm name (e.g. "/python_gc_stats")
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_stats_shm_open(const char* name);
+
+/**
+ * Stop the shared-memory stats export and unmap the segment. The name is not
+ * unlinked, so attached readers keep their mapping.
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_stats_shm_close(void);
+
+/**
+ * Stream a binary heap snapshot to a file for offline analysis
+ *
+ * Writes the object table and edge set in a compact varint format with the
+ * interned type-name table up front, streaming shard by shard with O(1)
+ * extra memory. The file can be memory-mapped and decoded offline.
+ *
+ * @param path Null-terminated path of the snapshot file to create
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_snapshot(const char* path);
+
+/* Event kinds reported through the allocation-event ring */
+#define GC_EVENT_OBJECT_CREATED 0
+#define GC_EVENT_OBJECT_DESTROYED 1
+#define GC_EVENT_COLLECTION_START 2
+#define GC_EVENT_COLLECTION_END 3
+
+/**
+ * One fixed-size record from the allocation-event ring.
+ *
+ * `ptr` is the object address for lifecycle events and zero for collection
+ * events; `generation` is meaningful for collection events only.
+ */
+typedef struct {
+    uint64_t timestamp_ns;
+    uint64_t ptr;
+    uint32_t type_id;
+    uint32_t kind;
+    uint32_t generation;
+    uint32_t reserved;
+} gc_event_t;
+
+/**
+ * Enable the allocation-event ring
+ *
+ * Tracking hooks and collections then append fixed-size records into a
+ * bounded lock-free ring at a few ns per event; when the ring wraps the
+ * oldest records are overwritten. Off by default.
+ *
+ * @return GC_SUCCESS on success
+ */
+gc_return_code_t py_gc_events_enable(void);
+
+/**
+ * Disable the allocation-event ring
+ * @return GC_SUCCESS on success
+ */
+gc_return_code_t py_gc_events_disable(void);
+
+/**
+ * Drain pending events into a caller buffer, oldest first
+ *
+ * Advances the consumer cursor past everything copied; records overwritten
+ * before they were drained are skipped. Call from one consumer thread only.
+ *
+ * @param buffer Destination array of at least max_events entries
+ * @param max_events Capacity of the buffer
+ * @return Number of events copied
+ */
+int32_t py_gc_events_drain(gc_event_t* buffer, int32_t max_events);
+
 /**
  * Get the number of tracked objects
  * @return Number of tracked objects
@@ -260,6 +443,22 @@ gc_return_code_t py_gc_set_threshold(int32_t generation, int32_t threshold);
  */
 int32_t py_gc_get_threshold(int32_t generation);
 
+/**
+ * Enable adaptive threshold pacing. Generation thresholds are auto-tuned
+ * after each collection toward spending the given percentage of wall time in
+ * collection, based on survival fraction and pause cost. Thresholds set via
+ * py_gc_set_threshold afterwards are pinned and left alone.
+ * @param target_overhead_percent Target collection overhead (e.g. 2.0)
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_enable_adaptive(double target_overhead_percent);
+
+/**
+ * Disable adaptive pacing; thresholds keep their last tuned values.
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_disable_adaptive(void);
+
 // Debug and State Functions
 
 /**
@@ -354,6 +553,35 @@ void* py_gc_get_referrers(void* obj_ptr);
  */
 void* py_gc_get_referents(void* obj_ptr);
 
+/**
+ * Visitor for the streaming iteration entry points. Called once per object
+ * with the user argument; return nonzero to stop the walk.
+ */
+typedef int (*gc_visit_fn)(void* obj, void* arg);
+
+/**
+ * Stream every tracked object through the visitor without materializing a
+ * list. The visitor must not call back into functions that modify tracking
+ * (py_gc_track, py_gc_untrack, py_gc_object_destroyed).
+ * @param visit Visitor callback
+ * @param arg Opaque argument forwarded to each call
+ * @return 0 after a full walk, the visitor's nonzero return on early exit,
+ *         -1 on invalid arguments
+ */
+int py_gc_visit_objects(gc_visit_fn visit, void* arg);
+
+/**
+ * Stream the objects that refer to obj_ptr through the visitor. Same
+ * early-exit contract as py_gc_visit_objects.
+ */
+int py_gc_visit_referrers(void* obj_ptr, gc_visit_fn visit, void* arg);
+
+/**
+ * Stream the objects that obj_ptr refers to through the visitor. Same
+ * early-exit contract as py_gc_visit_objects.
+ */
+int py_gc_visit_referents(void* obj_ptr, gc_visit_fn visit, void* arg);
+
 /**
  * Get garbage (uncollectable objects) (Python gc.get_garbage() compatibility)
  * @return Pointer to array of uncollectable objects, or NULL
@@ -385,6 +613,26 @@ gc_return_code_t py_gc_add_reference(void* from_obj, void* to_obj);
  */
 gc_return_code_t py_gc_remove_reference(void* from_obj, void* to_obj);
 
+/**
+ * Register a weak reference to a tracked object. Weak references never keep
+ * their referent alive; when the referent is collected (or destroyed via
+ * py_gc_object_destroyed), every registered slot is overwritten with NULL in
+ * one pass. The slot must stay valid until the referent dies or the slot is
+ * removed with py_gc_remove_weak_reference.
+ * @param obj Referent object pointer
+ * @param weak_slot Address of the pointer to clear when obj is collected
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_add_weak_reference(void* obj, void** weak_slot);
+
+/**
+ * Unregister a weak reference slot. The slot itself is left untouched.
+ * @param obj Referent object pointer
+ * @param weak_slot Slot previously passed to py_gc_add_weak_reference
+ * @return GC_SUCCESS on success, error code on failure
+ */
+gc_return_code_t py_gc_remove_weak_reference(void* obj, void** weak_slot);
+
 /**
  * Mark an object as uncollectable
  * @param obj_ptr Pointer to the object
@@ -406,6 +654,16 @@ gc_return_code_t py_gc_unmark_uncollectable(void* obj_ptr);
  */
 int32_t py_gc_is_uncollectable(void* obj_ptr);
 
+/**
+ * Pop the next queued uncollectable object, oldest first
+ *
+ * Each call transfers one entry out of the finalizer queue; nothing is
+ * copied. Drain the queue by calling until NULL is returned.
+ *
+ * @return Pointer to the next uncollectable object, or NULL if the queue is empty
+ */
+void* py_gc_next_garbage(void);
+
 // Debug and Utility Functions
 
 /**
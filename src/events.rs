@@ -0,0 +1,227 @@
+//! Opt-in allocation-event ring for low-overhead production profiling.
+//!
+//! Tracking hooks and the collector append fixed-size records (timestamp,
+//! pointer, type id, generation) into a bounded ring. Producers claim a slot
+//! with one relaxed `fetch_add` and fill it with plain stores — a few ns per
+//! event — and never block or wait: when the ring wraps, the oldest records
+//! are overwritten. The ring is a profiling aid, not a transactional log; a
+//! record being overwritten while the consumer copies it can tear, which a
+//! sampling profiler tolerates by design.
+//!
+//! Disabled (the default), the hooks cost one relaxed load and a branch.
+//! Drain from a single consumer thread via [`drain`].
+
+use std::cell::UnsafeCell;
+use std::sync::OnceLock;
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+
+/// Slots in the global ring; power of two so slot indexing is a mask.
+pub const EVENT_RING_CAPACITY: usize = 1 << 16;
+
+/// What a record describes. Stored as a raw `u32` in the record so the
+/// layout is FFI-stable.
+#[repr(u32)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum GCEventKind {
+    ObjectCreated = 0,
+    ObjectDestroyed = 1,
+    CollectionStart = 2,
+    CollectionEnd = 3,
+}
+
+/// One fixed-size event record. `ptr` is the object address for lifecycle
+/// events and zero for collection events; `generation` is meaningful for
+/// collection events only.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct GCEvent {
+    pub timestamp_ns: u64,
+    pub ptr: u64,
+    pub type_id: u32,
+    pub kind: u32,
+    pub generation: u32,
+    pub reserved: u32,
+}
+
+impl GCEvent {
+    const fn zeroed() -> Self {
+        Self {
+            timestamp_ns: 0,
+            ptr: 0,
+            type_id: 0,
+            kind: 0,
+            generation: 0,
+            reserved: 0,
+        }
+    }
+}
+
+/// Monotonic nanoseconds since the first event was timestamped.
+fn timestamp_ns() -> u64 {
+    static START: OnceLock<std::time::Instant> = OnceLock::new();
+    START.get_or_init(std::time::Instant::now).elapsed().as_nanos() as u64
+}
+
+/// Bounded multi-producer ring. `head` counts every record ever claimed;
+/// `tail` is the consumer cursor. Both only grow, so `head - tail` is the
+/// backlog and `head - capacity` the oldest slot still intact.
+#[derive(Debug)]
+pub struct EventRing {
+    slots: Box<[UnsafeCell<GCEvent>]>,
+    head: AtomicU64,
+    tail: AtomicU64,
+}
+
+unsafe impl Sync for EventRing {}
+
+impl EventRing {
+    pub fn new(capacity: usize) -> Self {
+        assert!(capacity.is_power_of_two());
+        Self {
+            slots: (0..capacity).map(|_| UnsafeCell::new(GCEvent::zeroed())).collect(),
+            head: AtomicU64::new(0),
+            tail: AtomicU64::new(0),
+        }
+    }
+
+    /// Append one record. Wait-free: claim a slot with a relaxed counter
+    /// bump, fill it with a plain store, done.
+    pub fn record(&self, kind: GCEventKind, ptr: u64, type_id: u32, generation: u32) {
+        let pos = self.head.fetch_add(1, Ordering::Relaxed);
+        let slot = (pos as usize) & (self.slots.len() - 1);
+        unsafe {
+            *self.slots[slot].get() = GCEvent {
+                timestamp_ns: timestamp_ns(),
+                ptr,
+                type_id,
+                kind: kind as u32,
+                generation,
+                reserved: 0,
+            };
+        }
+    }
+
+    /// Records appended but not yet drained (capped at capacity; older
+    /// backlog has been overwritten).
+    pub fn backlog(&self) -> usize {
+        let head = self.head.load(Ordering::Relaxed);
+        let tail = self.tail.load(Ordering::Relaxed);
+        ((head - tail) as usize).min(self.slots.len())
+    }
+
+    /// Copy up to `max` pending records, oldest first, and advance the
+    /// consumer cursor past everything copied. Records the ring overwrote
+    /// before the consumer got to them are skipped. Single consumer only.
+    pub fn drain(&self, max: usize) -> Vec<GCEvent> {
+        let head = self.head.load(Ordering::Relaxed);
+        let mut tail = self.tail.load(Ordering::Relaxed);
+
+        // Everything older than one full ring ago is already overwritten.
+        let oldest = head.saturating_sub(self.slots.len() as u64);
+        if tail < oldest {
+            tail = oldest;
+        }
+
+        let count = ((head - tail) as usize).min(max);
+        let mut out = Vec::with_capacity(count);
+        for pos in tail..tail + count as u64 {
+            let slot = (pos as usize) & (self.slots.len() - 1);
+            out.push(unsafe { *self.slots[slot].get() });
+        }
+
+        self.tail.store(tail + count as u64, Ordering::Relaxed);
+        out
+    }
+
+    pub fn clear(&self) {
+        self.tail
+            .store(self.head.load(Ordering::Relaxed), Ordering::Relaxed);
+    }
+}
+
+static EVENTS_ENABLED: AtomicBool = AtomicBool::new(false);
+
+fn ring() -> &'static EventRing {
+    static RING: OnceLock<EventRing> = OnceLock::new();
+    RING.get_or_init(|| EventRing::new(EVENT_RING_CAPACITY))
+}
+
+pub fn enable() {
+    EVENTS_ENABLED.store(true, Ordering::Relaxed);
+}
+
+pub fn disable() {
+    EVENTS_ENABLED.store(false, Ordering::Relaxed);
+}
+
+pub fn is_enabled() -> bool {
+    EVENTS_ENABLED.load(Ordering::Relaxed)
+}
+
+/// Append to the global ring if event collection is enabled. The disabled
+/// path is one relaxed load and a branch, cheap enough to leave in every
+/// hook unconditionally.
+#[inline(always)]
+pub fn record(kind: GCEventKind, ptr: u64, type_id: u32, generation: u32) {
+    if EVENTS_ENABLED.load(Ordering::Relaxed) {
+        ring().record(kind, ptr, type_id, generation);
+    }
+}
+
+/// Drain up to `max` records from the global ring. Single consumer only.
+pub fn drain(max: usize) -> Vec<GCEvent> {
+    ring().drain(max)
+}
+
+/// Drop whatever is pending in the global ring.
+pub fn clear() {
+    ring().clear();
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_ring_records_and_drains_in_order() {
+        let ring = EventRing::new(8);
+
+        ring.record(GCEventKind::ObjectCreated, 0x10, 7, 0);
+        ring.record(GCEventKind::CollectionStart, 0, 0, 1);
+        ring.record(GCEventKind::ObjectDestroyed, 0x10, 7, 0);
+        assert_eq!(ring.backlog(), 3);
+
+        let events = ring.drain(16);
+        assert_eq!(events.len(), 3);
+        assert_eq!(events[0].kind, GCEventKind::ObjectCreated as u32);
+        assert_eq!(events[0].ptr, 0x10);
+        assert_eq!(events[0].type_id, 7);
+        assert_eq!(events[1].kind, GCEventKind::CollectionStart as u32);
+        assert_eq!(events[1].generation, 1);
+        assert_eq!(events[2].kind, GCEventKind::ObjectDestroyed as u32);
+        assert_eq!(ring.backlog(), 0);
+        assert!(events.windows(2).all(|w| w[0].timestamp_ns <= w[1].timestamp_ns));
+    }
+
+    #[test]
+    fn test_ring_overwrites_oldest_on_wrap() {
+        let ring = EventRing::new(4);
+
+        for i in 0..10u64 {
+            ring.record(GCEventKind::ObjectCreated, i, 0, 0);
+        }
+
+        // Only the last `capacity` records survive; the drain skips the
+        // overwritten backlog.
+        let events = ring.drain(16);
+        assert_eq!(events.len(), 4);
+        assert_eq!(
+            events.iter().map(|e| e.ptr).collect::<Vec<_>>(),
+            vec![6, 7, 8, 9]
+        );
+    }
+
+    // The global ring is a process-wide singleton with a single-consumer
+    // drain, so its end-to-end coverage lives in the serialized FFI test
+    // suite; only local rings are exercised here.
+}
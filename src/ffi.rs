@@ -18,11 +18,33 @@ unsafe extern "C" {
 static mut GC: Option<GarbageCollector> = None;
 static AUTOMATIC_TRACKING: AtomicBool = AtomicBool::new(false);
 
+/// Buffered (pointer, delta) pairs per thread before the ring drains into
+/// the registry in one aggregated pass.
+const REFCOUNT_RING_CAPACITY: usize = 4096;
+
 thread_local! {
-    static OBJECT_REGISTRY: RefCell<HashMap<*mut c_void, PyObject>> = RefCell::new(HashMap::new());
+    static REFCOUNT_DELTAS: RefCell<Vec<(*mut c_void, i32)>> =
+        RefCell::new(Vec::with_capacity(REFCOUNT_RING_CAPACITY));
     static REFCOUNT_CALLBACKS: RefCell<HashMap<*mut c_void, RefCountCallback>> = RefCell::new(HashMap::new());
     static REFERENCE_TRACKING: RefCell<HashMap<*mut c_void, HashSet<*mut c_void>>> = RefCell::new(HashMap::new());
-    static UNCOLLECTABLE_OBJECTS: RefCell<Vec<*mut c_void>> = const { RefCell::new(Vec::new()) };
+}
+
+/// Process-wide finalizer queue for the C surface. `queue` preserves arrival
+/// order for [`py_gc_next_garbage`]; `members` mirrors live membership so
+/// `py_gc_is_uncollectable` is an O(1) set probe instead of a linear scan.
+/// Unmarking only drops the set entry; the stale queue slot is skipped lazily
+/// the next time the queue is drained or iterated. Pointers are stored as
+/// `usize` so the structure is `Send`.
+#[derive(Default)]
+struct FinalizerQueue {
+    queue: std::collections::VecDeque<usize>,
+    members: HashSet<usize>,
+}
+
+fn finalizer_queue() -> &'static parking_lot::Mutex<FinalizerQueue> {
+    static FINALIZER_QUEUE: std::sync::OnceLock<parking_lot::Mutex<FinalizerQueue>> =
+        std::sync::OnceLock::new();
+    FINALIZER_QUEUE.get_or_init(|| parking_lot::Mutex::new(FinalizerQueue::default()))
 }
 
 type RefCountCallback = Box<dyn Fn(*mut c_void, i32) + Send + Sync>;
@@ -91,35 +113,212 @@ struct PyTypeObject {
     tp_finalize: Option<unsafe extern "C" fn(*mut c_void)>,
 }
 
+/// Number of registry shards. Pointer keys are already unique and well
+/// distributed, so a few address bits pick the shard.
+const REGISTRY_SHARD_COUNT: usize = 16;
+
+/// Process-wide object registry, sharded by pointer address so objects
+/// tracked on one thread are visible to every other thread. Reads
+/// (`py_gc_is_tracked`, `py_gc_get_refcount`) take a shard read lock, writes
+/// stripe across the shards.
+struct ObjectRegistry {
+    shards: Vec<parking_lot::RwLock<HashMap<*mut c_void, PyObject>>>,
+    /// Recycled shadow-object records, one pool per shard. Destroyed entries
+    /// park here (up to [`OBJECT_POOL_CAPACITY`]) and the create path
+    /// reinitializes a pooled record in place instead of building a fresh
+    /// `PyObject`, keeping malloc/free out of the create/destroy hot path.
+    pools: Vec<parking_lot::Mutex<Vec<PyObject>>>,
+}
+
+/// Recycled records kept per registry shard.
+const OBJECT_POOL_CAPACITY: usize = 1024;
+
+unsafe impl Send for ObjectRegistry {}
+unsafe impl Sync for ObjectRegistry {}
+
+impl ObjectRegistry {
+    fn global() -> &'static ObjectRegistry {
+        static REGISTRY: std::sync::OnceLock<ObjectRegistry> = std::sync::OnceLock::new();
+        REGISTRY.get_or_init(|| ObjectRegistry {
+            shards: (0..REGISTRY_SHARD_COUNT)
+                .map(|_| parking_lot::RwLock::new(HashMap::new()))
+                .collect(),
+            pools: (0..REGISTRY_SHARD_COUNT)
+                .map(|_| parking_lot::Mutex::new(Vec::new()))
+                .collect(),
+        })
+    }
+}
+
+/// Build a shadow record for `obj_ptr`, reusing a pooled record from the
+/// pointer's shard when one is available.
+#[inline(always)]
+fn acquire_shadow_object(obj_ptr: *mut c_void, name: &str, data: ObjectData) -> PyObject {
+    let pooled = ObjectRegistry::global().pools[registry_shard_index(obj_ptr)]
+        .lock()
+        .pop();
+
+    match pooled {
+        Some(mut obj) => {
+            obj.reinit_ffi(name, data);
+            obj
+        }
+        None => PyObject::new_ffi(name, data, obj_ptr),
+    }
+}
+
+/// Park a destroyed entry's record in its shard pool for reuse; records past
+/// the pool capacity are simply dropped.
+#[inline(always)]
+fn recycle_shadow_object(obj_ptr: *mut c_void, obj: PyObject) {
+    let mut pool = ObjectRegistry::global().pools[registry_shard_index(obj_ptr)].lock();
+    if pool.len() < OBJECT_POOL_CAPACITY {
+        pool.push(obj);
+    }
+}
+
+#[inline(always)]
+fn registry_shard_index(obj_ptr: *mut c_void) -> usize {
+    // Skip the low alignment bits so consecutive allocations spread out.
+    (obj_ptr as usize >> 4) & (REGISTRY_SHARD_COUNT - 1)
+}
+
+/// Run `f` with the write-locked shard map covering `obj_ptr`. Only entries
+/// for that pointer may be touched inside `f`.
 #[inline(always)]
-fn with_object_registry<F, R>(f: F) -> R
+fn with_registry_shard_mut<F, R>(obj_ptr: *mut c_void, f: F) -> R
 where
     F: FnOnce(&mut HashMap<*mut c_void, PyObject>) -> R,
 {
-    OBJECT_REGISTRY.with(|registry| {
-        let mut registry = registry.borrow_mut();
-        f(&mut registry)
-    })
+    let mut shard = ObjectRegistry::global().shards[registry_shard_index(obj_ptr)].write();
+    f(&mut shard)
+}
+
+#[inline(always)]
+fn with_registry_entry<F, R>(obj_ptr: *mut c_void, f: F) -> R
+where
+    F: FnOnce(Option<&PyObject>) -> R,
+{
+    let shard = ObjectRegistry::global().shards[registry_shard_index(obj_ptr)].read();
+    f(shard.get(&obj_ptr))
 }
 
 #[inline(always)]
 fn is_object_tracked(obj_ptr: *mut c_void) -> bool {
-    OBJECT_REGISTRY.with(|registry| {
-        let registry = registry.borrow();
-        registry.contains_key(&obj_ptr)
-    })
+    ObjectRegistry::global().shards[registry_shard_index(obj_ptr)]
+        .read()
+        .contains_key(&obj_ptr)
 }
 
 #[inline(always)]
 fn track_object_fast(obj_ptr: *mut c_void, obj: PyObject) {
-    OBJECT_REGISTRY.with(|registry| {
-        registry.borrow_mut().insert(obj_ptr, obj);
+    with_registry_shard_mut(obj_ptr, |reg| {
+        reg.insert(obj_ptr, obj);
     });
 }
 
 #[inline(always)]
 fn untrack_object_fast(obj_ptr: *mut c_void) -> bool {
-    OBJECT_REGISTRY.with(|registry| registry.borrow_mut().remove(&obj_ptr).is_some())
+    with_registry_shard_mut(obj_ptr, |reg| reg.remove(&obj_ptr).is_some())
+}
+
+#[inline(always)]
+fn registry_len() -> usize {
+    ObjectRegistry::global()
+        .shards
+        .iter()
+        .map(|shard| shard.read().len())
+        .sum()
+}
+
+#[inline(always)]
+fn registry_clear() {
+    for shard in &ObjectRegistry::global().shards {
+        shard.write().clear();
+    }
+}
+
+/// Weak references registered against each object: every entry is the address
+/// of a pointer slot that must be nulled when the referent is collected.
+/// Process-wide like the registry; addresses are stored as `usize` so the map
+/// is `Send`.
+fn weak_references() -> &'static parking_lot::Mutex<HashMap<usize, Vec<usize>>> {
+    static WEAK_REFERENCES: std::sync::OnceLock<parking_lot::Mutex<HashMap<usize, Vec<usize>>>> =
+        std::sync::OnceLock::new();
+    WEAK_REFERENCES.get_or_init(|| parking_lot::Mutex::new(HashMap::new()))
+}
+
+/// Null out every weak slot registered against `obj_ptr` and drop its list.
+fn clear_weak_references(obj_ptr: *mut c_void) {
+    if let Some(slots) = weak_references().lock().remove(&(obj_ptr as usize)) {
+        for slot in slots {
+            unsafe {
+                *(slot as *mut *mut c_void) = std::ptr::null_mut();
+            }
+        }
+    }
+}
+
+#[inline(always)]
+fn registry_keys() -> Vec<*mut c_void> {
+    ObjectRegistry::global()
+        .shards
+        .iter()
+        .flat_map(|shard| shard.read().keys().copied().collect::<Vec<_>>())
+        .collect()
+}
+
+/// Buffer a refcount delta in the calling thread's ring with a plain store.
+/// Returns true once the ring is full and should be drained.
+#[inline(always)]
+fn buffer_refcount_delta(obj_ptr: *mut c_void, delta: i32) -> bool {
+    REFCOUNT_DELTAS.with(|ring| {
+        let mut ring = ring.borrow_mut();
+        ring.push((obj_ptr, delta));
+        ring.len() >= REFCOUNT_RING_CAPACITY
+    })
+}
+
+/// Drain the calling thread's delta ring: deltas are aggregated per pointer,
+/// applied to the registry once per object, and callbacks see the aggregate.
+/// Returns the number of distinct objects updated.
+fn drain_refcount_deltas() -> usize {
+    let ring = REFCOUNT_DELTAS.with(|ring| std::mem::take(&mut *ring.borrow_mut()));
+    if ring.is_empty() {
+        return 0;
+    }
+
+    let mut aggregated: HashMap<*mut c_void, i64> = HashMap::new();
+    for (obj_ptr, delta) in ring {
+        *aggregated.entry(obj_ptr).or_insert(0) += delta as i64;
+    }
+
+    // Only count entries actually applied to a registered object: deltas
+    // that net to zero and pointers the registry has never seen leave no
+    // refcount changed.
+    let mut updated = 0;
+    for (obj_ptr, delta) in aggregated {
+        if delta == 0 {
+            continue;
+        }
+
+        let applied = with_registry_shard_mut(obj_ptr, |reg| {
+            if let Some(obj) = reg.get_mut(&obj_ptr) {
+                let refcount = obj.get_refcount() as i64 + delta;
+                obj.set_refcount(refcount.max(0) as usize);
+                true
+            } else {
+                false
+            }
+        });
+
+        if applied {
+            updated += 1;
+            notify_refcount_change(obj_ptr, delta as i32);
+        }
+    }
+
+    updated
 }
 
 #[inline(always)]
@@ -213,28 +412,46 @@ unsafe fn create_python_list_from_objects(objects: Vec<*mut c_void>) -> *mut c_v
 
 #[inline(always)]
 fn add_uncollectable(obj_ptr: *mut c_void) {
-    UNCOLLECTABLE_OBJECTS.with(|uncollectable| {
-        if !uncollectable.borrow().contains(&obj_ptr) {
-            uncollectable.borrow_mut().push(obj_ptr);
-        }
-    });
+    let mut fq = finalizer_queue().lock();
+    if fq.members.insert(obj_ptr as usize) {
+        fq.queue.push_back(obj_ptr as usize);
+    }
 }
 
 #[inline(always)]
 fn remove_uncollectable(obj_ptr: *mut c_void) {
-    UNCOLLECTABLE_OBJECTS.with(|uncollectable| {
-        uncollectable.borrow_mut().retain(|&ptr| ptr != obj_ptr);
-    });
+    // Only membership is dropped; the stale queue entry is skipped when the
+    // queue is next drained.
+    finalizer_queue().lock().members.remove(&(obj_ptr as usize));
+}
+
+/// Transfer the oldest live queue entry to the caller, discarding stale
+/// entries left behind by `remove_uncollectable`.
+fn pop_uncollectable() -> Option<*mut c_void> {
+    let mut fq = finalizer_queue().lock();
+    while let Some(ptr) = fq.queue.pop_front() {
+        if fq.members.remove(&ptr) {
+            return Some(ptr as *mut c_void);
+        }
+    }
+    None
 }
 
 #[inline(always)]
 fn get_uncollectable_objects() -> Vec<*mut c_void> {
-    UNCOLLECTABLE_OBJECTS.with(|uncollectable| uncollectable.borrow().clone())
+    let fq = finalizer_queue().lock();
+    fq.queue
+        .iter()
+        .filter(|ptr| fq.members.contains(ptr))
+        .map(|&ptr| ptr as *mut c_void)
+        .collect()
 }
 
 #[inline(always)]
 fn clear_uncollectable_objects() {
-    UNCOLLECTABLE_OBJECTS.with(|uncollectable| uncollectable.borrow_mut().clear());
+    let mut fq = finalizer_queue().lock();
+    fq.queue.clear();
+    fq.members.clear();
 }
 
 const COMMON_NAMES: [&str; 4] = ["tracked_ptr", "list", "dict", "tuple"];
@@ -301,7 +518,8 @@ pub extern "C" fn py_gc_init() -> GCReturnCode {
 #[unsafe(no_mangle)]
 pub extern "C" fn py_gc_cleanup() -> GCReturnCode {
     unsafe {
-        with_object_registry(|reg| reg.clear());
+        registry_clear();
+        weak_references().lock().clear();
         REFCOUNT_CALLBACKS.with(|callbacks| callbacks.borrow_mut().clear());
         REFERENCE_TRACKING.with(|refs| refs.borrow_mut().clear());
         clear_uncollectable_objects();
@@ -382,7 +600,7 @@ pub unsafe extern "C" fn py_gc_get_state_string(
                 gc.get_generation_count(0).unwrap_or(0),
                 gc.get_generation_count(1).unwrap_or(0),
                 gc.get_generation_count(2).unwrap_or(0),
-                gc.get_uncollectable().len()
+                gc.uncollectable_count()
             );
 
             let bytes_to_copy = std::cmp::min(state_info.len(), buffer_size - 1);
@@ -423,6 +641,94 @@ pub extern "C" fn py_gc_track(obj_ptr: *mut c_void) -> GCReturnCode {
     GCReturnCode::Success
 }
 
+/// Track an array of objects with one boundary crossing.
+///
+/// The registry is borrowed once for the whole batch, so callers pay the FFI
+/// and lookup overhead per batch instead of per object. NULL entries and
+/// already-tracked pointers are skipped.
+///
+/// # Safety
+///
+/// - `objs` must point to `count` valid object pointers (or be NULL with
+///   `count` 0)
+/// - Each non-NULL entry must point to a valid `PyObject`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn py_gc_track_batch(objs: *mut *mut c_void, count: usize) -> c_int {
+    if objs.is_null() {
+        return if count == 0 { 0 } else { -1 };
+    }
+
+    let ptrs = unsafe { std::slice::from_raw_parts(objs, count) };
+
+    // Partition by shard so each shard lock is taken once per batch.
+    let mut buckets: Vec<Vec<*mut c_void>> = vec![Vec::new(); REGISTRY_SHARD_COUNT];
+    for &obj_ptr in ptrs {
+        if !obj_ptr.is_null() {
+            buckets[registry_shard_index(obj_ptr)].push(obj_ptr);
+        }
+    }
+
+    let mut tracked = 0;
+    for (shard_idx, bucket) in buckets.into_iter().enumerate() {
+        if bucket.is_empty() {
+            continue;
+        }
+
+        let mut reg = ObjectRegistry::global().shards[shard_idx].write();
+        reg.reserve(bucket.len());
+
+        for obj_ptr in bucket {
+            if reg.contains_key(&obj_ptr) {
+                continue;
+            }
+
+            let obj = unsafe { (*(obj_ptr as *mut PyObject)).clone() };
+            reg.insert(obj_ptr, obj);
+            tracked += 1;
+        }
+    }
+
+    tracked
+}
+
+/// Untrack an array of objects with one boundary crossing. NULL entries and
+/// untracked pointers are skipped.
+///
+/// # Safety
+///
+/// - `objs` must point to `count` object pointers (or be NULL with `count` 0)
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn py_gc_untrack_batch(objs: *mut *mut c_void, count: usize) -> c_int {
+    if objs.is_null() {
+        return if count == 0 { 0 } else { -1 };
+    }
+
+    let ptrs = unsafe { std::slice::from_raw_parts(objs, count) };
+
+    let mut buckets: Vec<Vec<*mut c_void>> = vec![Vec::new(); REGISTRY_SHARD_COUNT];
+    for &obj_ptr in ptrs {
+        if !obj_ptr.is_null() {
+            buckets[registry_shard_index(obj_ptr)].push(obj_ptr);
+        }
+    }
+
+    let mut untracked = 0;
+    for (shard_idx, bucket) in buckets.into_iter().enumerate() {
+        if bucket.is_empty() {
+            continue;
+        }
+
+        let mut reg = ObjectRegistry::global().shards[shard_idx].write();
+        for obj_ptr in bucket {
+            if reg.remove(&obj_ptr).is_some() {
+                untracked += 1;
+            }
+        }
+    }
+
+    untracked
+}
+
 #[unsafe(no_mangle)]
 pub extern "C" fn py_gc_untrack(obj_ptr: *mut c_void) -> GCReturnCode {
     unsafe {
@@ -450,6 +756,7 @@ pub extern "C" fn py_gc_collect_generation(generation: c_int) -> GCReturnCode {
                 return GCReturnCode::ErrorInvalidGeneration;
             }
 
+            drain_refcount_deltas();
             gc.collect_generation(generation as usize).into()
         } else {
             GCReturnCode::ErrorInternal
@@ -459,6 +766,7 @@ pub extern "C" fn py_gc_collect_generation(generation: c_int) -> GCReturnCode {
 
 #[unsafe(no_mangle)]
 pub extern "C" fn py_gc_collect() -> GCReturnCode {
+    drain_refcount_deltas();
     unsafe {
         if let Some(ref gc) = GC {
             gc.collect().into()
@@ -468,6 +776,53 @@ pub extern "C" fn py_gc_collect() -> GCReturnCode {
     }
 }
 
+/// Start dedicated background collector threads that watch the collection
+/// triggers and drain shards in short incremental slices off the caller's
+/// path. `threads` is clamped to the shard count.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_start_background_collector(threads: c_int) -> GCReturnCode {
+    unsafe {
+        if let Some(ref mut gc) = GC {
+            if threads <= 0 {
+                return GCReturnCode::ErrorInternal;
+            }
+            gc.start_background_collector(threads as usize).into()
+        } else {
+            GCReturnCode::ErrorInternal
+        }
+    }
+}
+
+/// Stop the background collector threads and wait for them to exit.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_stop_background_collector() -> GCReturnCode {
+    unsafe {
+        if let Some(ref mut gc) = GC {
+            gc.stop_background_collector();
+            GCReturnCode::Success
+        } else {
+            GCReturnCode::ErrorInternal
+        }
+    }
+}
+
+/// Incremental collection bounded by a microsecond budget. Does a slice of
+/// collection work per shard, yielding the shard locks between slices; a
+/// cycle cut short by the budget resumes on the next call.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_collect_budget_us(budget_us: u64) -> c_int {
+    unsafe {
+        if let Some(ref gc) = GC {
+            match gc.collect_with_budget(std::time::Duration::from_micros(budget_us)) {
+                Ok(collected) => collected as c_int,
+                Err(_) => -1,
+            }
+        } else {
+            -1
+        }
+    }
+}
+
 #[unsafe(no_mangle)]
 pub extern "C" fn py_gc_needs_collection() -> c_int {
     unsafe {
@@ -547,6 +902,39 @@ pub extern "C" fn py_gc_get_threshold(generation: c_int) -> c_int {
     }
 }
 
+/// Enables adaptive threshold pacing: generation thresholds are auto-tuned
+/// after each collection toward spending `target_overhead_percent` of wall
+/// time in collection. Thresholds set via py_gc_set_threshold afterwards are
+/// pinned and left alone.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_enable_adaptive(target_overhead_percent: f64) -> GCReturnCode {
+    unsafe {
+        if let Some(ref mut gc) = GC {
+            if !(target_overhead_percent > 0.0) {
+                return GCReturnCode::ErrorInternal;
+            }
+
+            gc.enable_adaptive_thresholds(target_overhead_percent);
+            GCReturnCode::Success
+        } else {
+            GCReturnCode::ErrorInternal
+        }
+    }
+}
+
+/// Disables adaptive pacing; thresholds keep their last tuned values.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_disable_adaptive() -> GCReturnCode {
+    unsafe {
+        if let Some(ref mut gc) = GC {
+            gc.disable_adaptive_thresholds();
+            GCReturnCode::Success
+        } else {
+            GCReturnCode::ErrorInternal
+        }
+    }
+}
+
 #[unsafe(no_mangle)]
 pub extern "C" fn py_gc_set_debug(flags: c_int) -> GCReturnCode {
     unsafe {
@@ -602,37 +990,114 @@ pub unsafe extern "C" fn py_gc_get_stats(stats: *mut GCStats) -> GCReturnCode {
     }
 }
 
-#[unsafe(no_mangle)]
-pub extern "C" fn py_gc_is_tracked(obj_ptr: *mut c_void) -> c_int {
-    if obj_ptr.is_null() {
-        return 0;
-    }
-
-    is_object_tracked(obj_ptr) as c_int
+#[repr(C)]
+pub struct GCStatsV2 {
+    pub collections: [u64; 3],
+    pub collected: [u64; 3],
+    pub promotions: [u64; 3],
+    pub pause_buckets: [u64; crate::stats::PAUSE_BUCKET_COUNT],
+    pub total_pause_us: u64,
+    pub max_pause_us: u64,
+    pub total_tracked: c_int,
+    pub generation_counts: [c_int; 3],
+    pub uncollectable: c_int,
 }
 
+/// Retrieves extended garbage collection statistics: per-generation
+/// collection/collected/promotion counters and the pause-time histogram
+/// (power-of-two microsecond buckets) recorded around every collection.
+///
+/// # Safety
+///
+/// The caller must ensure that `stats` is a valid pointer to a `gc_stats_v2_t`
+/// struct. The function will write to the memory pointed to by `stats`.
 #[unsafe(no_mangle)]
-pub extern "C" fn py_gc_get_uncollectable_count() -> c_int {
+pub unsafe extern "C" fn py_gc_get_stats_v2(stats: *mut GCStatsV2) -> GCReturnCode {
     unsafe {
         if let Some(ref gc) = GC {
-            gc.get_uncollectable().len() as c_int
+            if stats.is_null() {
+                return GCReturnCode::ErrorInternal;
+            }
+
+            let rust_stats = gc.get_stats();
+            let telemetry = crate::stats::CollectionTelemetry::global().snapshot();
+            *stats = GCStatsV2 {
+                collections: telemetry.collections,
+                collected: telemetry.collected,
+                promotions: telemetry.promotions,
+                pause_buckets: telemetry.pause_buckets,
+                total_pause_us: telemetry.total_pause_us,
+                max_pause_us: telemetry.max_pause_us,
+                total_tracked: rust_stats.total_tracked as c_int,
+                generation_counts: [
+                    rust_stats.generation_counts[0] as c_int,
+                    rust_stats.generation_counts[1] as c_int,
+                    rust_stats.generation_counts[2] as c_int,
+                ],
+                uncollectable: rust_stats.uncollectable as c_int,
+            };
+
+            GCReturnCode::Success
         } else {
-            0
+            GCReturnCode::ErrorInternal
         }
     }
 }
 
+/// Opens (creating if needed) a named POSIX shared-memory segment laid out as
+/// `gc_stats_shm_t` and mirrors the telemetry counters into it after every
+/// collection. External processes mmap the segment and read it with the
+/// seqlock protocol, never touching a GC lock.
+///
+/// # Safety
+///
+/// The caller must ensure that `name` is a valid NUL-terminated C string.
 #[unsafe(no_mangle)]
-pub extern "C" fn py_gc_get_registry_count() -> c_int {
-    with_object_registry(|reg| reg.len() as c_int)
+pub unsafe extern "C" fn py_gc_stats_shm_open(name: *const c_char) -> GCReturnCode {
+    if name.is_null() {
+        return GCReturnCode::ErrorInternal;
+    }
+
+    let name = unsafe { std::ffi::CStr::from_ptr(name) };
+    match name.to_str() {
+        Ok(name) => match crate::stats::shm::open(name) {
+            Ok(()) => GCReturnCode::Success,
+            Err(_) => GCReturnCode::ErrorInternal,
+        },
+        Err(_) => GCReturnCode::ErrorInternal,
+    }
 }
 
+/// Stops the shared-memory stats export and unmaps the segment. The name is
+/// not unlinked, so attached readers keep their mapping.
 #[unsafe(no_mangle)]
-pub extern "C" fn py_gc_clear_uncollectable() -> GCReturnCode {
+pub extern "C" fn py_gc_stats_shm_close() -> GCReturnCode {
+    crate::stats::shm::close();
+    GCReturnCode::Success
+}
+
+/// Stream a binary heap snapshot to `path` for offline analysis
+///
+/// # Safety
+///
+/// - `path` must be a valid null-terminated C string
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn py_gc_snapshot(path: *const std::os::raw::c_char) -> GCReturnCode {
+    if path.is_null() {
+        return GCReturnCode::ErrorInternal;
+    }
+
+    let path = unsafe { std::ffi::CStr::from_ptr(path) };
+    let Ok(path) = path.to_str() else {
+        return GCReturnCode::ErrorInternal;
+    };
+
     unsafe {
         if let Some(ref gc) = GC {
-            gc.clear_uncollectable();
-            GCReturnCode::Success
+            match crate::snapshot::snapshot_to_path(gc, path) {
+                Ok(()) => GCReturnCode::Success,
+                Err(_) => GCReturnCode::ErrorInternal,
+            }
         } else {
             GCReturnCode::ErrorInternal
         }
@@ -640,44 +1105,166 @@ pub extern "C" fn py_gc_clear_uncollectable() -> GCReturnCode {
 }
 
 #[unsafe(no_mangle)]
-pub extern "C" fn py_gc_clear_registry() -> GCReturnCode {
-    with_object_registry(|reg| {
-        reg.clear();
-        GCReturnCode::Success
-    });
+pub extern "C" fn py_gc_events_enable() -> GCReturnCode {
+    crate::events::enable();
     GCReturnCode::Success
 }
 
 #[unsafe(no_mangle)]
-pub extern "C" fn py_gc_add_reference(from_obj: *mut c_void, to_obj: *mut c_void) -> GCReturnCode {
-    if from_obj.is_null() || to_obj.is_null() {
-        return GCReturnCode::ErrorInternal;
-    }
-
-    add_reference(from_obj, to_obj);
+pub extern "C" fn py_gc_events_disable() -> GCReturnCode {
+    crate::events::disable();
     GCReturnCode::Success
 }
 
+/// Drain pending allocation/collection events into a caller buffer
+///
+/// Copies up to `max_events` records, oldest first, and advances the
+/// consumer cursor. Call from one consumer thread only.
+///
+/// # Safety
+///
+/// - `buffer` must point to at least `max_events` `gc_event_t` slots
 #[unsafe(no_mangle)]
-pub extern "C" fn py_gc_remove_reference(
-    from_obj: *mut c_void,
-    to_obj: *mut c_void,
-) -> GCReturnCode {
-    if from_obj.is_null() || to_obj.is_null() {
-        return GCReturnCode::ErrorInternal;
+pub unsafe extern "C" fn py_gc_events_drain(
+    buffer: *mut crate::events::GCEvent,
+    max_events: c_int,
+) -> c_int {
+    if buffer.is_null() || max_events <= 0 {
+        return 0;
     }
 
-    remove_reference(from_obj, to_obj);
-    GCReturnCode::Success
+    let events = crate::events::drain(max_events as usize);
+    unsafe {
+        std::ptr::copy_nonoverlapping(events.as_ptr(), buffer, events.len());
+    }
+    events.len() as c_int
 }
 
 #[unsafe(no_mangle)]
-pub extern "C" fn py_gc_mark_uncollectable(obj_ptr: *mut c_void) -> GCReturnCode {
+pub extern "C" fn py_gc_is_tracked(obj_ptr: *mut c_void) -> c_int {
     if obj_ptr.is_null() {
-        return GCReturnCode::ErrorInternal;
+        return 0;
     }
 
-    add_uncollectable(obj_ptr);
+    is_object_tracked(obj_ptr) as c_int
+}
+
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_get_uncollectable_count() -> c_int {
+    unsafe {
+        if let Some(ref gc) = GC {
+            gc.uncollectable_count() as c_int
+        } else {
+            0
+        }
+    }
+}
+
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_get_registry_count() -> c_int {
+    registry_len() as c_int
+}
+
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_clear_uncollectable() -> GCReturnCode {
+    unsafe {
+        if let Some(ref gc) = GC {
+            gc.clear_uncollectable();
+            GCReturnCode::Success
+        } else {
+            GCReturnCode::ErrorInternal
+        }
+    }
+}
+
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_clear_registry() -> GCReturnCode {
+    registry_clear();
+    GCReturnCode::Success
+}
+
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_add_reference(from_obj: *mut c_void, to_obj: *mut c_void) -> GCReturnCode {
+    if from_obj.is_null() || to_obj.is_null() {
+        return GCReturnCode::ErrorInternal;
+    }
+
+    add_reference(from_obj, to_obj);
+    GCReturnCode::Success
+}
+
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_remove_reference(
+    from_obj: *mut c_void,
+    to_obj: *mut c_void,
+) -> GCReturnCode {
+    if from_obj.is_null() || to_obj.is_null() {
+        return GCReturnCode::ErrorInternal;
+    }
+
+    remove_reference(from_obj, to_obj);
+    GCReturnCode::Success
+}
+
+/// Registers `weak_slot` as a weak reference to `obj_ptr`. Weak references
+/// never keep their referent alive; when the collector frees `obj_ptr` (or
+/// py_gc_object_destroyed runs), every registered slot is overwritten with
+/// NULL in one pass, so readers observe the dead referent as a cleared slot.
+///
+/// # Safety
+///
+/// The caller must ensure that `weak_slot` points to writable pointer-sized
+/// storage that outlives the referent or is removed first via
+/// py_gc_remove_weak_reference.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn py_gc_add_weak_reference(
+    obj_ptr: *mut c_void,
+    weak_slot: *mut *mut c_void,
+) -> GCReturnCode {
+    if obj_ptr.is_null() || weak_slot.is_null() {
+        return GCReturnCode::ErrorInternal;
+    }
+
+    if !is_object_tracked(obj_ptr) {
+        return GCReturnCode::ErrorNotTracked;
+    }
+
+    weak_references()
+        .lock()
+        .entry(obj_ptr as usize)
+        .or_default()
+        .push(weak_slot as usize);
+    GCReturnCode::Success
+}
+
+/// Unregisters a weak reference before the slot's storage goes away. The slot
+/// itself is left untouched.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_remove_weak_reference(
+    obj_ptr: *mut c_void,
+    weak_slot: *mut *mut c_void,
+) -> GCReturnCode {
+    if obj_ptr.is_null() || weak_slot.is_null() {
+        return GCReturnCode::ErrorInternal;
+    }
+
+    let mut weak = weak_references().lock();
+    if let Some(slots) = weak.get_mut(&(obj_ptr as usize)) {
+        slots.retain(|&slot| slot != weak_slot as usize);
+        if slots.is_empty() {
+            weak.remove(&(obj_ptr as usize));
+        }
+    }
+    GCReturnCode::Success
+}
+
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_mark_uncollectable(obj_ptr: *mut c_void) -> GCReturnCode {
+    if obj_ptr.is_null() {
+        return GCReturnCode::ErrorInternal;
+    }
+
+    add_uncollectable(obj_ptr);
     GCReturnCode::Success
 }
 
@@ -697,13 +1284,15 @@ pub extern "C" fn py_gc_is_uncollectable(obj_ptr: *mut c_void) -> c_int {
         return 0;
     }
 
-    UNCOLLECTABLE_OBJECTS.with(|uncollectable| {
-        if uncollectable.borrow().contains(&obj_ptr) {
-            1
-        } else {
-            0
-        }
-    })
+    finalizer_queue().lock().members.contains(&(obj_ptr as usize)) as c_int
+}
+
+/// Hand out the next queued uncollectable object, oldest first, or null once
+/// the queue is empty. Each call transfers one entry out of the queue;
+/// nothing is copied.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_next_garbage() -> *mut c_void {
+    pop_uncollectable().unwrap_or(std::ptr::null_mut())
 }
 
 /// Get information about a tracked object
@@ -742,11 +1331,11 @@ pub unsafe extern "C" fn py_gc_get_tracked_info(
                 return GCReturnCode::ErrorNotTracked;
             }
 
-            let obj_info = with_object_registry(|reg| {
-                if let Some(obj) = reg.get(&obj_ptr) {
+            let obj_info = with_registry_entry(obj_ptr, |entry| {
+                if let Some(obj) = entry {
                     format!(
                         "Object: {} (ID: {}, Refs: {}, Ptr: {:p})",
-                        obj.name,
+                        obj.type_name(),
                         obj.id.as_usize(),
                         obj.get_refcount(),
                         obj_ptr
@@ -802,7 +1391,7 @@ pub extern "C" fn py_gc_debug_state() -> GCReturnCode {
             println!("  Generation 2: {}", stats.generation_counts[2]);
             println!("  Uncollectable: {}", stats.uncollectable);
 
-            let registry_count = with_object_registry(|reg| reg.len());
+            let registry_count = registry_len();
             println!("  Registry count: {registry_count}");
 
             GCReturnCode::Success
@@ -850,20 +1439,24 @@ pub extern "C" fn py_gc_object_created(obj_ptr: *mut c_void) -> GCReturnCode {
 
         let py_obj = obj_ptr as *mut PyObject_HEAD;
         let py_type = (*py_obj).ob_type;
-        let type_name = if !py_type.is_null() {
+        let type_name: std::borrow::Cow<str> = if !py_type.is_null() {
             let type_name_ptr = (*py_type).tp_name;
             if !type_name_ptr.is_null() {
-                std::ffi::CStr::from_ptr(type_name_ptr)
-                    .to_string_lossy()
-                    .to_string()
+                std::ffi::CStr::from_ptr(type_name_ptr).to_string_lossy()
             } else {
-                "unknown".to_string()
+                "unknown".into()
             }
         } else {
-            "unknown".to_string()
+            "unknown".into()
         };
 
-        let obj = PyObject::new_ffi(&type_name, ObjectData::None, obj_ptr);
+        let obj = acquire_shadow_object(obj_ptr, &type_name, ObjectData::None);
+        crate::events::record(
+            crate::events::GCEventKind::ObjectCreated,
+            obj_ptr as u64,
+            obj.type_id.0,
+            0,
+        );
 
         track_object_fast(obj_ptr, obj);
 
@@ -889,11 +1482,21 @@ pub extern "C" fn py_gc_object_destroyed(obj_ptr: *mut c_void) -> GCReturnCode {
     }
 
     unregister_refcount_callback(obj_ptr);
-
-    if untrack_object_fast(obj_ptr) {
-        GCReturnCode::Success
-    } else {
-        GCReturnCode::ErrorNotTracked
+    clear_weak_references(obj_ptr);
+
+    let removed = with_registry_shard_mut(obj_ptr, |reg| reg.remove(&obj_ptr));
+    match removed {
+        Some(obj) => {
+            crate::events::record(
+                crate::events::GCEventKind::ObjectDestroyed,
+                obj_ptr as u64,
+                obj.type_id.0,
+                0,
+            );
+            recycle_shadow_object(obj_ptr, obj);
+            GCReturnCode::Success
+        }
+        None => GCReturnCode::ErrorNotTracked,
     }
 }
 
@@ -912,8 +1515,12 @@ pub extern "C" fn py_gc_refcount_changed(
             return GCReturnCode::ErrorInternal;
         }
 
+        // Buffer the delta with a plain thread-local store; the registry is
+        // only touched when the ring drains, not per refcount twitch.
         let delta = new_count - old_count;
-        notify_refcount_change(obj_ptr, delta);
+        if buffer_refcount_delta(obj_ptr, delta) {
+            drain_refcount_deltas();
+        }
 
         if new_count == 0 {
             if let Some(ref gc) = GC {
@@ -925,14 +1532,21 @@ pub extern "C" fn py_gc_refcount_changed(
     }
 }
 
+/// Drain the calling thread's buffered refcount deltas into the registry.
+/// Also runs automatically when the ring fills and at collection start.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_flush_refcount_deltas() -> c_int {
+    drain_refcount_deltas() as c_int
+}
+
 #[unsafe(no_mangle)]
 pub extern "C" fn py_gc_get_refcount(obj_ptr: *mut c_void) -> c_int {
     if obj_ptr.is_null() {
         return 0;
     }
 
-    with_object_registry(|reg| {
-        if let Some(obj) = reg.get(&obj_ptr) {
+    with_registry_entry(obj_ptr, |entry| {
+        if let Some(obj) = entry {
             obj.get_refcount() as c_int
         } else {
             unsafe {
@@ -957,7 +1571,7 @@ pub unsafe extern "C" fn py_gc_set_refcount(obj_ptr: *mut c_void, refcount: c_in
     }
 
     let mut success = false;
-    with_object_registry(|reg| {
+    with_registry_shard_mut(obj_ptr, |reg| {
         if let Some(obj) = reg.get_mut(&obj_ptr) {
             let current_refcount = obj.get_refcount();
             let target_refcount = refcount as usize;
@@ -1015,10 +1629,8 @@ pub unsafe extern "C" fn py_gc_set_refcount(obj_ptr: *mut c_void, refcount: c_in
 /// - The caller is responsible for decrementing the reference count when done
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn py_gc_get_objects() -> *mut c_void {
-    with_object_registry(|reg| {
-        let objects: Vec<*mut c_void> = reg.keys().copied().collect();
-        unsafe { create_python_list_from_objects(objects) }
-    })
+    let objects = registry_keys();
+    unsafe { create_python_list_from_objects(objects) }
 }
 
 /// Get objects that refer to the given object
@@ -1055,6 +1667,103 @@ pub unsafe extern "C" fn py_gc_get_referents(obj_ptr: *mut c_void) -> *mut c_voi
     unsafe { create_python_list_from_objects(references) }
 }
 
+/// Visitor signature for the streaming iteration entry points: called once
+/// per object with the user argument; a nonzero return stops the walk.
+pub type GCVisitFn = unsafe extern "C" fn(obj: *mut c_void, arg: *mut c_void) -> c_int;
+
+/// Streams every tracked object through `visit` without materializing a list:
+/// the registry shards are walked in place under their read locks, so a 30M
+/// object heap costs no allocation at all. A nonzero return from `visit`
+/// stops the walk and is returned; a completed walk returns 0, bad arguments
+/// return -1.
+///
+/// # Safety
+///
+/// - `visit` must be a valid function pointer
+/// - `visit` must not call back into tracking functions that take registry
+///   write locks (py_gc_track, py_gc_untrack, py_gc_object_destroyed)
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn py_gc_visit_objects(visit: Option<GCVisitFn>, arg: *mut c_void) -> c_int {
+    let Some(visit) = visit else {
+        return -1;
+    };
+
+    for shard in &ObjectRegistry::global().shards {
+        let shard = shard.read();
+        for &obj_ptr in shard.keys() {
+            let stop = unsafe { visit(obj_ptr, arg) };
+            if stop != 0 {
+                return stop;
+            }
+        }
+    }
+    0
+}
+
+/// Streams the objects that refer to `obj_ptr` through `visit`, with the same
+/// early-exit contract as py_gc_visit_objects.
+///
+/// # Safety
+///
+/// Same contract as [`py_gc_visit_objects`].
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn py_gc_visit_referrers(
+    obj_ptr: *mut c_void,
+    visit: Option<GCVisitFn>,
+    arg: *mut c_void,
+) -> c_int {
+    let Some(visit) = visit else {
+        return -1;
+    };
+    if obj_ptr.is_null() {
+        return -1;
+    }
+
+    REFERENCE_TRACKING.with(|refs| {
+        for (&from_obj, references) in refs.borrow().iter() {
+            if references.contains(&obj_ptr) {
+                let stop = unsafe { visit(from_obj, arg) };
+                if stop != 0 {
+                    return stop;
+                }
+            }
+        }
+        0
+    })
+}
+
+/// Streams the objects that `obj_ptr` refers to through `visit`, with the
+/// same early-exit contract as py_gc_visit_objects.
+///
+/// # Safety
+///
+/// Same contract as [`py_gc_visit_objects`].
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn py_gc_visit_referents(
+    obj_ptr: *mut c_void,
+    visit: Option<GCVisitFn>,
+    arg: *mut c_void,
+) -> c_int {
+    let Some(visit) = visit else {
+        return -1;
+    };
+    if obj_ptr.is_null() {
+        return -1;
+    }
+
+    REFERENCE_TRACKING.with(|refs| {
+        if let Some(references) = refs.borrow().get(&obj_ptr) {
+            for &to_obj in references.iter() {
+                let stop = unsafe { visit(to_obj, arg) };
+                if stop != 0 {
+                    return stop;
+                }
+            }
+        }
+        0
+    })
+}
+
 #[unsafe(no_mangle)]
 pub extern "C" fn py_gc_is_tracked_python(obj_ptr: *mut c_void) -> c_int {
     if obj_ptr.is_null() {
@@ -1232,8 +1941,8 @@ pub extern "C" fn py_gc_has_finalizer(obj_ptr: *mut c_void) -> c_int {
         return 0;
     }
 
-    with_object_registry(|reg| {
-        if let Some(obj) = reg.get(&obj_ptr) {
+    with_registry_entry(obj_ptr, |entry| {
+        if let Some(obj) = entry {
             if obj.has_finalizer { 1 } else { 0 }
         } else {
             0 // Object not tracked, so no finalizer
@@ -1247,7 +1956,7 @@ pub extern "C" fn py_gc_set_finalizer(obj_ptr: *mut c_void, has_finalizer: c_int
         return GCReturnCode::ErrorInternal;
     }
 
-    with_object_registry(|reg| {
+    with_registry_shard_mut(obj_ptr, |reg| {
         if let Some(obj) = reg.get_mut(&obj_ptr) {
             obj.set_finalizer(has_finalizer != 0);
             GCReturnCode::Success
@@ -1263,15 +1972,15 @@ pub extern "C" fn py_gc_get_object_size(obj_ptr: *mut c_void) -> c_int {
         return 0;
     }
 
-    with_object_registry(|reg| {
-        if let Some(obj) = reg.get(&obj_ptr) {
+    with_registry_entry(obj_ptr, |entry| {
+        if let Some(obj) = entry {
             match &obj.data {
                 ObjectData::Integer(_) => 8,
                 ObjectData::Float(_) => 8,
                 ObjectData::String(s) => s.len() as c_int,
-                ObjectData::List(l) => (l.len() * std::mem::size_of::<PyObject>()) as c_int,
+                ObjectData::List(l) => (l.len() * std::mem::size_of::<crate::ObjectId>()) as c_int,
                 ObjectData::Dict(d) => {
-                    (d.len() * std::mem::size_of::<(PyObject, PyObject)>()) as c_int
+                    (d.len() * std::mem::size_of::<(crate::ObjectId, crate::ObjectId)>()) as c_int
                 }
                 ObjectData::Custom(_) => std::mem::size_of::<*mut c_void>() as c_int,
                 ObjectData::None => 0,
@@ -1310,11 +2019,11 @@ pub unsafe extern "C" fn py_gc_get_object_type_name(
         return GCReturnCode::ErrorInternal;
     }
 
-    let type_name = with_object_registry(|reg| {
-        if let Some(obj) = reg.get(&obj_ptr) {
-            obj.name.clone()
+    let type_name = with_registry_entry(obj_ptr, |entry| {
+        if let Some(obj) = entry {
+            obj.type_name()
         } else {
-            "unknown".to_string()
+            "unknown"
         }
     });
 
@@ -1327,18 +2036,372 @@ pub unsafe extern "C" fn py_gc_get_object_type_name(
     GCReturnCode::Success
 }
 
+type TraverseProc = unsafe extern "C" fn(*mut c_void, *mut c_void, *mut c_void) -> c_int;
+
+#[inline(always)]
+unsafe fn traverse_of(obj_ptr: *mut c_void) -> Option<TraverseProc> {
+    unsafe {
+        let py_type = (*(obj_ptr as *mut PyObject_HEAD)).ob_type;
+        if py_type.is_null() {
+            None
+        } else {
+            (*py_type).tp_traverse
+        }
+    }
+}
+
+#[inline(always)]
+unsafe fn clear_of(obj_ptr: *mut c_void) -> Option<unsafe extern "C" fn(*mut c_void) -> c_int> {
+    unsafe {
+        let py_type = (*(obj_ptr as *mut PyObject_HEAD)).ob_type;
+        if py_type.is_null() {
+            None
+        } else {
+            (*py_type).tp_clear
+        }
+    }
+}
+
+unsafe extern "C" fn subtract_refs_visit(child: *mut c_void, arg: *mut c_void) -> c_int {
+    let gc_refs = unsafe { &mut *(arg as *mut HashMap<*mut c_void, isize>) };
+    if let Some(refs) = gc_refs.get_mut(&child) {
+        *refs -= 1;
+    }
+    0
+}
+
+struct MarkContext {
+    gc_refs: *const HashMap<*mut c_void, isize>,
+    reachable: HashSet<*mut c_void>,
+    stack: Vec<*mut c_void>,
+}
+
+unsafe extern "C" fn mark_reachable_visit(child: *mut c_void, arg: *mut c_void) -> c_int {
+    let ctx = unsafe { &mut *(arg as *mut MarkContext) };
+    let tracked = unsafe { &*ctx.gc_refs };
+    if tracked.contains_key(&child) && ctx.reachable.insert(child) {
+        ctx.stack.push(child);
+    }
+    0
+}
+
+/// Run a CPython-style cycle collection driven by each tracked object's
+/// `tp_traverse` slot instead of the manually maintained reference map.
+///
+/// Copies every tracked object's `ob_refcnt` into a scratch `gc_refs` table,
+/// subtracts one for every internal edge reported by `tp_traverse`, marks from
+/// the objects whose count stays positive (externally referenced roots), and
+/// sweeps the rest: `tp_clear` breaks their cycles and they are untracked.
+/// Objects whose type has no `tp_traverse` are treated as leaf objects.
+///
+/// Returns the number of objects collected, or -1 if the GC is not
+/// initialized. Only meaningful for objects registered through the automatic
+/// tracking hooks, whose pointers carry a real `PyObject_HEAD`.
+#[unsafe(no_mangle)]
+pub extern "C" fn py_gc_collect_traverse() -> c_int {
+    if py_gc_is_initialized() == 0 {
+        return -1;
+    }
+
+    let ptrs: Vec<*mut c_void> = registry_keys();
+
+    unsafe {
+        let mut gc_refs: HashMap<*mut c_void, isize> = HashMap::with_capacity(ptrs.len());
+        for &obj_ptr in &ptrs {
+            let refcount = (*(obj_ptr as *mut PyObject_HEAD)).ob_refcnt as isize;
+            gc_refs.insert(obj_ptr, refcount);
+        }
+
+        for &obj_ptr in &ptrs {
+            if let Some(traverse) = traverse_of(obj_ptr) {
+                traverse(
+                    obj_ptr,
+                    subtract_refs_visit as usize as *mut c_void,
+                    &mut gc_refs as *mut _ as *mut c_void,
+                );
+            }
+        }
+
+        let mut ctx = MarkContext {
+            gc_refs: &gc_refs,
+            reachable: HashSet::new(),
+            stack: Vec::new(),
+        };
+
+        for (&obj_ptr, &refs) in &gc_refs {
+            if refs > 0 && ctx.reachable.insert(obj_ptr) {
+                ctx.stack.push(obj_ptr);
+            }
+        }
+
+        while let Some(obj_ptr) = ctx.stack.pop() {
+            if let Some(traverse) = traverse_of(obj_ptr) {
+                traverse(
+                    obj_ptr,
+                    mark_reachable_visit as usize as *mut c_void,
+                    &mut ctx as *mut _ as *mut c_void,
+                );
+            }
+        }
+
+        let mut collected = 0;
+        // One lock acquisition clears every swept object's weakref list.
+        let mut weak = weak_references().lock();
+        for &obj_ptr in &ptrs {
+            if !ctx.reachable.contains(&obj_ptr) {
+                if let Some(clear) = clear_of(obj_ptr) {
+                    clear(obj_ptr);
+                }
+                if let Some(slots) = weak.remove(&(obj_ptr as usize)) {
+                    for slot in slots {
+                        *(slot as *mut *mut c_void) = std::ptr::null_mut();
+                    }
+                }
+                unregister_refcount_callback(obj_ptr);
+                untrack_object_fast(obj_ptr);
+                collected += 1;
+            }
+        }
+        drop(weak);
+
+        collected
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
 
+    // The registry and GC statics are process-wide, so FFI tests serialize
+    // on this lock instead of racing each other's init/cleanup.
+    static FFI_TEST_LOCK: std::sync::Mutex<()> = std::sync::Mutex::new(());
+
     #[test]
     fn test_gc_init_cleanup() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
         assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
         assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
     }
 
+    #[test]
+    fn test_registry_visible_across_threads() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+
+        let obj = PyObject::new("cross_thread".to_string(), ObjectData::Integer(7));
+        let obj_ptr = Box::into_raw(Box::new(obj)) as usize;
+
+        std::thread::spawn(move || {
+            assert_eq!(
+                py_gc_track(obj_ptr as *mut c_void) as i32,
+                GCReturnCode::Success as i32
+            );
+        })
+        .join()
+        .unwrap();
+
+        // Tracked on the worker thread, visible here.
+        assert_eq!(py_gc_is_tracked(obj_ptr as *mut c_void), 1);
+        assert_eq!(py_gc_untrack(obj_ptr as *mut c_void) as i32, GCReturnCode::Success as i32);
+
+        unsafe {
+            let _ = Box::from_raw(obj_ptr as *mut PyObject);
+        }
+
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
+    #[test]
+    fn test_gc_stats_v2() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+
+        let obj = PyObject::new("stats_v2".to_string(), ObjectData::Integer(1));
+        let obj_ptr = Box::into_raw(Box::new(obj)) as *mut c_void;
+        assert_eq!(py_gc_track(obj_ptr) as i32, GCReturnCode::Success as i32);
+        assert_eq!(py_gc_collect() as i32, GCReturnCode::Success as i32);
+
+        let mut stats = std::mem::MaybeUninit::<GCStatsV2>::zeroed();
+        let code = unsafe { py_gc_get_stats_v2(stats.as_mut_ptr()) };
+        assert_eq!(code as i32, GCReturnCode::Success as i32);
+
+        let stats = unsafe { stats.assume_init() };
+        // py_gc_collect runs generation 2, so at least one gen-2 collection
+        // and one pause sample must be recorded by now.
+        assert!(stats.collections[2] >= 1);
+        assert!(stats.pause_buckets.iter().sum::<u64>() >= 1);
+
+        unsafe {
+            let _ = Box::from_raw(obj_ptr as *mut PyObject);
+        }
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
+    #[test]
+    fn test_weak_reference_cleared_on_destroy() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+
+        let obj = PyObject::new("referent".to_string(), ObjectData::Integer(9));
+        let obj_ptr = Box::into_raw(Box::new(obj)) as *mut c_void;
+        assert_eq!(py_gc_track(obj_ptr) as i32, GCReturnCode::Success as i32);
+
+        let mut slot: *mut c_void = obj_ptr;
+        let mut removed_slot: *mut c_void = obj_ptr;
+        unsafe {
+            assert_eq!(
+                py_gc_add_weak_reference(obj_ptr, &mut slot) as i32,
+                GCReturnCode::Success as i32
+            );
+            assert_eq!(
+                py_gc_add_weak_reference(obj_ptr, &mut removed_slot) as i32,
+                GCReturnCode::Success as i32
+            );
+        }
+        assert_eq!(
+            py_gc_remove_weak_reference(obj_ptr, &mut removed_slot) as i32,
+            GCReturnCode::Success as i32
+        );
+
+        assert_eq!(
+            py_gc_object_destroyed(obj_ptr) as i32,
+            GCReturnCode::Success as i32
+        );
+
+        // The registered slot is nulled; the removed one keeps its value.
+        assert!(slot.is_null());
+        assert_eq!(removed_slot, obj_ptr);
+
+        unsafe {
+            let _ = Box::from_raw(obj_ptr as *mut PyObject);
+        }
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
+    #[test]
+    fn test_visit_objects_streams_and_stops() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+
+        let mut ptrs = Vec::new();
+        for i in 0..5 {
+            let obj = PyObject::new("visited".to_string(), ObjectData::Integer(i));
+            let obj_ptr = Box::into_raw(Box::new(obj)) as *mut c_void;
+            assert_eq!(py_gc_track(obj_ptr) as i32, GCReturnCode::Success as i32);
+            ptrs.push(obj_ptr);
+        }
+        add_reference(ptrs[0], ptrs[1]);
+        add_reference(ptrs[0], ptrs[2]);
+
+        unsafe extern "C" fn count_visit(_obj: *mut c_void, arg: *mut c_void) -> c_int {
+            unsafe { *(arg as *mut c_int) += 1 };
+            0
+        }
+        unsafe extern "C" fn stop_visit(_obj: *mut c_void, arg: *mut c_void) -> c_int {
+            unsafe { *(arg as *mut c_int) += 1 };
+            7
+        }
+
+        unsafe {
+            let mut seen: c_int = 0;
+            assert_eq!(
+                py_gc_visit_objects(Some(count_visit), &mut seen as *mut c_int as *mut c_void),
+                0
+            );
+            assert_eq!(seen, 5);
+
+            // Early exit: the visitor's nonzero return comes back after one call.
+            let mut stopped: c_int = 0;
+            assert_eq!(
+                py_gc_visit_objects(Some(stop_visit), &mut stopped as *mut c_int as *mut c_void),
+                7
+            );
+            assert_eq!(stopped, 1);
+
+            let mut referents: c_int = 0;
+            assert_eq!(
+                py_gc_visit_referents(
+                    ptrs[0],
+                    Some(count_visit),
+                    &mut referents as *mut c_int as *mut c_void
+                ),
+                0
+            );
+            assert_eq!(referents, 2);
+
+            let mut referrers: c_int = 0;
+            assert_eq!(
+                py_gc_visit_referrers(
+                    ptrs[1],
+                    Some(count_visit),
+                    &mut referrers as *mut c_int as *mut c_void
+                ),
+                0
+            );
+            assert_eq!(referrers, 1);
+
+            assert_eq!(py_gc_visit_objects(None, std::ptr::null_mut()), -1);
+        }
+
+        for obj_ptr in ptrs {
+            py_gc_untrack(obj_ptr);
+            unsafe {
+                let _ = Box::from_raw(obj_ptr as *mut PyObject);
+            }
+        }
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
+    #[test]
+    fn test_shadow_object_pool_recycles() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+        py_gc_enable_automatic_tracking();
+
+        // A fabricated object with a null type: the created hook only reads
+        // the header, so this is enough to exercise the shadow lifecycle.
+        let mut head = PyObject_HEAD {
+            ob_refcnt: 1,
+            ob_type: std::ptr::null_mut(),
+        };
+        let obj_ptr = &mut head as *mut PyObject_HEAD as *mut c_void;
+        let pool_idx = registry_shard_index(obj_ptr);
+
+        assert_eq!(
+            py_gc_object_created(obj_ptr) as i32,
+            GCReturnCode::Success as i32
+        );
+        let pooled_before = ObjectRegistry::global().pools[pool_idx].lock().len();
+        assert_eq!(
+            py_gc_object_destroyed(obj_ptr) as i32,
+            GCReturnCode::Success as i32
+        );
+
+        // The destroyed entry's record parked in the shard pool...
+        let pooled_after = ObjectRegistry::global().pools[pool_idx].lock().len();
+        assert_eq!(pooled_after, pooled_before + 1);
+
+        // ...and the next create on this shard consumes it.
+        assert_eq!(
+            py_gc_object_created(obj_ptr) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(
+            ObjectRegistry::global().pools[pool_idx].lock().len(),
+            pooled_after - 1
+        );
+
+        assert_eq!(
+            py_gc_object_destroyed(obj_ptr) as i32,
+            GCReturnCode::Success as i32
+        );
+        py_gc_disable_automatic_tracking();
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
     #[test]
     fn test_gc_enable_disable() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
         assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
 
         assert_eq!(py_gc_disable() as i32, GCReturnCode::Success as i32);
@@ -1352,6 +2415,7 @@ mod tests {
 
     #[test]
     fn test_gc_collection() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
         assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
 
         let result = py_gc_collect();
@@ -1360,8 +2424,180 @@ mod tests {
         assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
     }
 
+    #[test]
+    fn test_refcount_delta_batching() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+        assert_eq!(
+            py_gc_enable_automatic_tracking() as i32,
+            GCReturnCode::Success as i32
+        );
+
+        let obj = PyObject::new("delta".to_string(), ObjectData::Integer(0));
+        let obj_ptr = Box::into_raw(Box::new(obj)) as *mut c_void;
+        assert_eq!(py_gc_track(obj_ptr) as i32, GCReturnCode::Success as i32);
+        assert_eq!(py_gc_get_refcount(obj_ptr), 1);
+
+        // Deltas accumulate in the thread-local ring without touching the
+        // registry until the explicit flush.
+        assert_eq!(
+            py_gc_refcount_changed(obj_ptr, 1, 3) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(
+            py_gc_refcount_changed(obj_ptr, 3, 4) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(py_gc_get_refcount(obj_ptr), 1);
+
+        assert_eq!(py_gc_flush_refcount_deltas(), 1);
+        assert_eq!(py_gc_get_refcount(obj_ptr), 4);
+
+        // Deltas that net to zero, or that target a pointer the registry has
+        // never seen, update no object and are not counted by the flush.
+        let stranger = PyObject::new("stranger".to_string(), ObjectData::Integer(0));
+        let stranger_ptr = Box::into_raw(Box::new(stranger)) as *mut c_void;
+        assert_eq!(
+            py_gc_refcount_changed(obj_ptr, 4, 6) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(
+            py_gc_refcount_changed(obj_ptr, 6, 4) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(
+            py_gc_refcount_changed(stranger_ptr, 1, 2) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(py_gc_flush_refcount_deltas(), 0);
+        assert_eq!(py_gc_get_refcount(obj_ptr), 4);
+        unsafe {
+            let _ = Box::from_raw(stranger_ptr as *mut PyObject);
+        }
+
+        assert_eq!(py_gc_untrack(obj_ptr) as i32, GCReturnCode::Success as i32);
+        unsafe {
+            let _ = Box::from_raw(obj_ptr as *mut PyObject);
+        }
+
+        assert_eq!(
+            py_gc_disable_automatic_tracking() as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
+    #[test]
+    fn test_batch_track_untrack() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+
+        let mut ptrs: Vec<*mut c_void> = (0..16)
+            .map(|i| {
+                let obj = PyObject::new("batch".to_string(), ObjectData::Integer(i));
+                Box::into_raw(Box::new(obj)) as *mut c_void
+            })
+            .collect();
+
+        let tracked = unsafe { py_gc_track_batch(ptrs.as_mut_ptr(), ptrs.len()) };
+        assert_eq!(tracked, 16);
+        assert_eq!(py_gc_is_tracked(ptrs[0]), 1);
+
+        // Re-tracking the same batch is a no-op.
+        let retracked = unsafe { py_gc_track_batch(ptrs.as_mut_ptr(), ptrs.len()) };
+        assert_eq!(retracked, 0);
+
+        let untracked = unsafe { py_gc_untrack_batch(ptrs.as_mut_ptr(), ptrs.len()) };
+        assert_eq!(untracked, 16);
+        assert_eq!(py_gc_is_tracked(ptrs[0]), 0);
+
+        for ptr in ptrs {
+            unsafe {
+                let _ = Box::from_raw(ptr as *mut PyObject);
+            }
+        }
+
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
+    #[repr(C)]
+    struct FakeGCObject {
+        head: PyObject_HEAD,
+        peer: *mut FakeGCObject,
+    }
+
+    unsafe extern "C" fn fake_traverse(
+        obj: *mut c_void,
+        visit: *mut c_void,
+        arg: *mut c_void,
+    ) -> c_int {
+        unsafe {
+            let fake = obj as *mut FakeGCObject;
+            if !(*fake).peer.is_null() {
+                let visit: unsafe extern "C" fn(*mut c_void, *mut c_void) -> c_int =
+                    std::mem::transmute(visit);
+                return visit((*fake).peer as *mut c_void, arg);
+            }
+        }
+        0
+    }
+
+    #[test]
+    fn test_traverse_collection_breaks_cycle() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+
+        let mut cycle_type: PyTypeObject = unsafe { std::mem::zeroed() };
+        cycle_type.tp_flags = PY_TPFLAGS_HAVE_GC;
+        cycle_type.tp_traverse = Some(fake_traverse);
+        let type_ptr = Box::into_raw(Box::new(cycle_type));
+
+        // Two objects referencing each other with no external references,
+        // plus one externally held root.
+        let make = |refcnt: usize| -> *mut FakeGCObject {
+            Box::into_raw(Box::new(FakeGCObject {
+                head: PyObject_HEAD {
+                    ob_refcnt: refcnt,
+                    ob_type: type_ptr,
+                },
+                peer: std::ptr::null_mut(),
+            }))
+        };
+
+        let a = make(1);
+        let b = make(1);
+        let root = make(2);
+        unsafe {
+            (*a).peer = b;
+            (*b).peer = a;
+        }
+
+        for &ptr in &[a, b, root] {
+            track_object_fast(
+                ptr as *mut c_void,
+                PyObject::new_ffi("fake", ObjectData::None, ptr as *mut c_void),
+            );
+        }
+
+        let collected = py_gc_collect_traverse();
+        assert_eq!(collected, 2);
+        assert_eq!(py_gc_is_tracked(a as *mut c_void), 0);
+        assert_eq!(py_gc_is_tracked(b as *mut c_void), 0);
+        assert_eq!(py_gc_is_tracked(root as *mut c_void), 1);
+
+        unsafe {
+            let _ = Box::from_raw(a);
+            let _ = Box::from_raw(b);
+            let _ = Box::from_raw(root);
+            let _ = Box::from_raw(type_ptr);
+        }
+
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
     #[test]
     fn test_finalizer_behavior() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
         assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
 
         let obj1 = PyObject::new("regular_obj".to_string(), ObjectData::Integer(42));
@@ -1395,4 +2631,108 @@ mod tests {
 
         assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
     }
+
+    #[test]
+    fn test_event_ring_records_lifecycle() {
+        use crate::events::{GCEvent, GCEventKind};
+
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+        crate::events::clear();
+        assert_eq!(py_gc_events_enable() as i32, GCReturnCode::Success as i32);
+        assert_eq!(
+            py_gc_enable_automatic_tracking() as i32,
+            GCReturnCode::Success as i32
+        );
+
+        let mut head = PyObject_HEAD {
+            ob_refcnt: 1,
+            ob_type: std::ptr::null_mut(),
+        };
+        let obj_ptr = &mut head as *mut PyObject_HEAD as *mut c_void;
+        assert_eq!(
+            py_gc_object_created(obj_ptr) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(
+            py_gc_object_destroyed(obj_ptr) as i32,
+            GCReturnCode::Success as i32
+        );
+
+        assert_eq!(
+            py_gc_disable_automatic_tracking() as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(py_gc_events_disable() as i32, GCReturnCode::Success as i32);
+
+        // Concurrent collections elsewhere may have logged events too while
+        // the ring was on; drain everything and filter for our pointer.
+        let zeroed = GCEvent {
+            timestamp_ns: 0,
+            ptr: 0,
+            type_id: 0,
+            kind: 0,
+            generation: 0,
+            reserved: 0,
+        };
+        let mut buffer = vec![zeroed; 256];
+        let mut ours: Vec<GCEvent> = Vec::new();
+        loop {
+            let drained = unsafe { py_gc_events_drain(buffer.as_mut_ptr(), 256) };
+            if drained == 0 {
+                break;
+            }
+            ours.extend(
+                buffer[..drained as usize]
+                    .iter()
+                    .filter(|event| event.ptr == obj_ptr as u64),
+            );
+        }
+
+        assert_eq!(ours.len(), 2);
+        assert_eq!(ours[0].kind, GCEventKind::ObjectCreated as u32);
+        assert_eq!(ours[1].kind, GCEventKind::ObjectDestroyed as u32);
+        assert_eq!(ours[0].type_id, ours[1].type_id);
+        assert!(ours[0].timestamp_ns <= ours[1].timestamp_ns);
+
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
+
+    #[test]
+    fn test_finalizer_queue_drains_in_order() {
+        let _guard = FFI_TEST_LOCK.lock().unwrap();
+        assert_eq!(py_gc_init() as i32, GCReturnCode::Success as i32);
+        clear_uncollectable_objects();
+
+        let first = 0x1000 as *mut c_void;
+        let second = 0x2000 as *mut c_void;
+        let third = 0x3000 as *mut c_void;
+        for ptr in [first, second, third] {
+            assert_eq!(
+                py_gc_mark_uncollectable(ptr) as i32,
+                GCReturnCode::Success as i32
+            );
+        }
+
+        // Re-marking is a no-op; membership is a set probe.
+        assert_eq!(
+            py_gc_mark_uncollectable(second) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(py_gc_is_uncollectable(second), 1);
+
+        // Unmarking drops membership; the stale queue entry is skipped when
+        // the queue drains.
+        assert_eq!(
+            py_gc_unmark_uncollectable(second) as i32,
+            GCReturnCode::Success as i32
+        );
+        assert_eq!(py_gc_is_uncollectable(second), 0);
+
+        assert_eq!(py_gc_next_garbage(), first);
+        assert_eq!(py_gc_next_garbage(), third);
+        assert!(py_gc_next_garbage().is_null());
+
+        assert_eq!(py_gc_cleanup() as i32, GCReturnCode::Success as i32);
+    }
 }
@@ -5,12 +5,27 @@ use crate::object::{ObjectId, PyObject};
 use parking_lot::RwLock;
 use std::sync::Arc;
 
+/// Default number of collector shards. Tracking routes by object id, so
+/// concurrent allocator threads mostly hit distinct shard locks.
+pub const DEFAULT_SHARDS: usize = 8;
+
+/// Worker threads spawned by [`GarbageCollector::start_background_collector`].
+/// Shards are partitioned across the workers; each worker polls its shards'
+/// collection triggers and drains them in short incremental slices so the
+/// stop-the-world window per shard stays bounded.
+#[derive(Debug)]
+struct BackgroundCollector {
+    stop: Arc<std::sync::atomic::AtomicBool>,
+    handles: Vec<std::thread::JoinHandle<()>>,
+}
+
 #[derive(Debug)]
 pub struct GarbageCollector {
-    collector: Arc<RwLock<Collector>>,
+    shards: Vec<Arc<RwLock<Collector>>>,
     enabled: bool,
     thresholds: [usize; 3],
     debug_flags: u32,
+    background: Option<BackgroundCollector>,
 }
 
 unsafe impl Send for GarbageCollector {}
@@ -18,12 +33,130 @@ unsafe impl Sync for GarbageCollector {}
 
 impl GarbageCollector {
     pub fn new() -> Self {
+        Self::with_shards(DEFAULT_SHARDS)
+    }
+
+    /// Create a collector with an explicit shard count (rounded up to a power
+    /// of two so shard selection is a mask instead of a modulo).
+    pub fn with_shards(shards: usize) -> Self {
+        let shard_count = shards.max(1).next_power_of_two();
+        let shards = (0..shard_count)
+            .map(|_| Arc::new(RwLock::new(Collector::new())))
+            .collect();
+
         Self {
-            collector: Arc::new(RwLock::new(Collector::new())),
+            shards,
             enabled: true,
             thresholds: [700, 10, 10],
             debug_flags: 0,
+            background: None,
+        }
+    }
+
+    /// Start `threads` dedicated collector threads that watch the generation
+    /// thresholds and collect off the request path. Each thread owns a
+    /// partition of the shards, so collection on one shard never blocks
+    /// tracking on the others, and work is done in bounded slices with the
+    /// shard lock released in between.
+    pub fn start_background_collector(&mut self, threads: usize) -> GCResult<()> {
+        use std::sync::atomic::{AtomicBool, Ordering};
+
+        if self.background.is_some() {
+            return Err(GCError::CollectionInProgress);
         }
+
+        const SLICE_OBJECTS: usize = 1024;
+        const POLL_INTERVAL: std::time::Duration = std::time::Duration::from_millis(1);
+
+        let threads = threads.clamp(1, self.shards.len());
+        let stop = Arc::new(AtomicBool::new(false));
+        let mut handles = Vec::with_capacity(threads);
+
+        for worker_idx in 0..threads {
+            let my_shards: Vec<Arc<RwLock<Collector>>> = self
+                .shards
+                .iter()
+                .skip(worker_idx)
+                .step_by(threads)
+                .cloned()
+                .collect();
+            let stop = stop.clone();
+
+            handles.push(std::thread::spawn(move || {
+                while !stop.load(Ordering::Relaxed) {
+                    for shard in &my_shards {
+                        let needs = {
+                            let collector = shard.read();
+                            (0..3).any(|gen_idx| {
+                                collector.generation_manager.should_collect_generation(gen_idx)
+                            })
+                        };
+
+                        if !needs {
+                            continue;
+                        }
+
+                        // Drain in slices, reacquiring the lock each time so
+                        // the pause seen by trackers stays short.
+                        loop {
+                            if stop.load(Ordering::Relaxed) {
+                                return;
+                            }
+
+                            let done = {
+                                let mut collector = shard.write();
+                                if !collector.incremental_active {
+                                    collector.begin_incremental(2);
+                                }
+                                match collector.collect_slice(SLICE_OBJECTS) {
+                                    Ok((_, done)) => done,
+                                    Err(_) => true,
+                                }
+                            };
+
+                            if done {
+                                break;
+                            }
+                        }
+                    }
+
+                    std::thread::sleep(POLL_INTERVAL);
+                }
+            }));
+        }
+
+        self.background = Some(BackgroundCollector { stop, handles });
+        Ok(())
+    }
+
+    /// Stop the background collector threads and wait for them to exit.
+    pub fn stop_background_collector(&mut self) {
+        if let Some(background) = self.background.take() {
+            background
+                .stop
+                .store(true, std::sync::atomic::Ordering::Relaxed);
+            for handle in background.handles {
+                let _ = handle.join();
+            }
+        }
+    }
+
+    pub fn has_background_collector(&self) -> bool {
+        self.background.is_some()
+    }
+
+    /// Shard handles for crate-internal walkers (snapshotting) that need to
+    /// stream each shard's objects under its read lock.
+    pub(crate) fn shards(&self) -> &[Arc<RwLock<Collector>>] {
+        &self.shards
+    }
+
+    pub fn shard_count(&self) -> usize {
+        self.shards.len()
+    }
+
+    fn shard_for(&self, obj_id: &ObjectId) -> &Arc<RwLock<Collector>> {
+        &self.shards[obj_id.as_usize() & (self.shards.len() - 1)]
     }
 
     pub fn enable(&mut self) {
@@ -38,37 +171,45 @@ impl GarbageCollector {
         self.enabled
     }
 
-    pub fn track(&mut self, obj: PyObject) -> GCResult<()> {
+    /// Track an object on the shard selected by its id. Takes `&self`: the
+    /// shard lock provides the mutation, so concurrent callers only contend
+    /// when they hash to the same shard.
+    pub fn track(&self, obj: PyObject) -> GCResult<()> {
         if !self.enabled {
             return Ok(());
         }
 
-        {
-            let mut collector = self.collector.write();
-            collector.track_object_fast(obj)
-        }
+        let mut collector = self.shard_for(&obj.id).write();
+        collector.track_object_fast(obj)
     }
 
-    pub fn track_bulk(&mut self, objects: Vec<PyObject>) -> GCResult<()> {
+    pub fn track_bulk(&self, objects: Vec<PyObject>) -> GCResult<()> {
         if !self.enabled {
             return Ok(());
         }
 
-        {
-            let mut collector = self.collector.write();
-            collector.track_objects_bulk(objects)
+        // Partition once so each shard lock is taken a single time.
+        let mut per_shard: Vec<Vec<PyObject>> = (0..self.shards.len()).map(|_| Vec::new()).collect();
+        for obj in objects {
+            per_shard[obj.id.as_usize() & (self.shards.len() - 1)].push(obj);
+        }
+
+        for (shard, batch) in self.shards.iter().zip(per_shard) {
+            if !batch.is_empty() {
+                shard.write().track_objects_bulk(batch)?;
+            }
         }
+
+        Ok(())
     }
 
-    pub fn untrack(&mut self, obj_id: &ObjectId) -> GCResult<()> {
+    pub fn untrack(&self, obj_id: &ObjectId) -> GCResult<()> {
         if !self.enabled {
             return Ok(());
         }
 
-        {
-            let mut collector = self.collector.write();
-            collector.untrack_object_fast(obj_id)
-        }
+        let mut collector = self.shard_for(obj_id).write();
+        collector.untrack_object_fast(obj_id)
     }
 
     pub fn collect_generation(&self, generation: usize) -> GCResult<usize> {
@@ -76,33 +217,109 @@ impl GarbageCollector {
             return Ok(0);
         }
 
-        let mut collector = self.collector.write();
-        collector.collect_generation(generation)
+        let mut collected = 0;
+        for shard in &self.shards {
+            collected += shard.write().collect_generation(generation)?;
+        }
+        Ok(collected)
     }
 
     pub fn collect(&self) -> GCResult<usize> {
+        self.collect_generation(2)
+    }
+
+    /// Incremental collection with a pause target: performs bounded slices of
+    /// work per shard and releases each shard lock between slices, so
+    /// concurrent track/untrack calls interleave instead of stalling for a
+    /// full cycle. Mark state persists in the `collecting` bits of each
+    /// `PyGCHead`, so a cycle cut short by the budget resumes on the next
+    /// call. Returns the number of objects collected within the budget.
+    pub fn collect_with_budget(&self, budget: std::time::Duration) -> GCResult<usize> {
+        const SLICE_OBJECTS: usize = 1024;
+
         if !self.enabled {
             return Ok(0);
         }
 
-        let mut collector = self.collector.write();
-        collector.collect_generation(2)
+        let start = std::time::Instant::now();
+        let mut total = 0;
+        let mut finished = vec![false; self.shards.len()];
+
+        loop {
+            let mut all_done = true;
+
+            for (shard_idx, shard) in self.shards.iter().enumerate() {
+                if finished[shard_idx] {
+                    continue;
+                }
+
+                {
+                    let mut collector = shard.write();
+                    if !collector.incremental_active {
+                        collector.begin_incremental(2);
+                    }
+
+                    let (collected, done) = collector.collect_slice(SLICE_OBJECTS)?;
+                    total += collected;
+                    finished[shard_idx] = done;
+                }
+
+                if !finished[shard_idx] {
+                    all_done = false;
+                }
+
+                if start.elapsed() >= budget {
+                    return Ok(total);
+                }
+            }
+
+            if all_done {
+                return Ok(total);
+            }
+        }
     }
 
     pub fn needs_collection(&self) -> bool {
-        let collector = self.collector.read();
-        collector.generation_manager.should_collect_generation(0)
+        self.shards.iter().any(|shard| {
+            shard
+                .read()
+                .generation_manager
+                .should_collect_generation(0)
+        })
     }
 
     pub fn get_stats(&self) -> crate::GCStats {
-        let collector = self.collector.read();
-        collector.get_stats()
+        let mut stats = crate::GCStats {
+            collections: 0,
+            collected: 0,
+            uncollectable: 0,
+            total_tracked: 0,
+            generation_counts: [0; 3],
+        };
+
+        for shard in &self.shards {
+            let shard_stats = shard.read().get_stats();
+            stats.uncollectable += shard_stats.uncollectable;
+            stats.total_tracked += shard_stats.total_tracked;
+            for gen_idx in 0..3 {
+                stats.generation_counts[gen_idx] += shard_stats.generation_counts[gen_idx];
+            }
+        }
+
+        // Collection counters live in the process-wide telemetry; the per-shard
+        // stats only carry the instantaneous heap shape.
+        let telemetry = crate::stats::CollectionTelemetry::global().snapshot();
+        stats.collections = telemetry.collections.iter().sum::<u64>() as usize;
+        stats.collected = telemetry.collected.iter().sum::<u64>() as usize;
+
+        stats
     }
 
     pub fn set_debug(&mut self, flags: u32) {
         self.debug_flags = flags;
-        let mut collector = self.collector.write();
-        collector.set_debug_flags(flags);
+        for shard in &self.shards {
+            shard.write().set_debug_flags(flags);
+        }
     }
 
     pub fn get_debug(&self) -> u32 {
@@ -110,8 +327,7 @@ impl GarbageCollector {
     }
 
     pub fn get_count(&self) -> usize {
-        let collector = self.collector.read();
-        collector.get_count()
+        self.shards.iter().map(|shard| shard.read().get_count()).sum()
     }
 
     pub fn get_generation_count(&self, generation: usize) -> Option<usize> {
@@ -119,13 +335,19 @@ impl GarbageCollector {
             return None;
         }
 
-        let collector = self.collector.read();
-        collector
-            .generation_manager
-            .get_generation(generation)
-            .map(|g| g.count)
+        let mut count = 0;
+        for shard in &self.shards {
+            count += shard
+                .read()
+                .generation_manager
+                .get_generation(generation)
+                .map(|g| g.count)?;
+        }
+        Some(count)
     }
 
+    /// Set a generation threshold on every shard. With adaptive pacing
+    /// enabled this pins the generation, so the tuner stops adjusting it.
     pub fn set_threshold(&mut self, generation: usize, threshold: usize) -> GCResult<()> {
         if generation >= 3 {
             return Err(GCError::Internal(format!(
@@ -134,11 +356,41 @@ impl GarbageCollector {
         }
 
         self.thresholds[generation] = threshold;
+        for shard in &self.shards {
+            shard.write().set_generation_threshold(generation, threshold)?;
+        }
         Ok(())
     }
 
+    /// Current per-shard threshold for a generation. Under adaptive pacing
+    /// the shards tune independently; this reports the first shard's value.
     pub fn get_threshold(&self, generation: usize) -> Option<usize> {
-        self.thresholds.get(generation).copied()
+        if generation >= 3 {
+            return None;
+        }
+
+        self.shards[0]
+            .read()
+            .generation_manager
+            .get_generation(generation)
+            .map(|g| g.threshold)
+    }
+
+    /// Enable adaptive threshold pacing on every shard: thresholds are tuned
+    /// after each collection toward spending `target_overhead_percent` of
+    /// wall time in collection, using survival fraction and pause cost.
+    /// Thresholds set manually afterwards are pinned and left alone.
+    pub fn enable_adaptive_thresholds(&mut self, target_overhead_percent: f64) {
+        for shard in &self.shards {
+            shard.write().set_adaptive(target_overhead_percent / 100.0);
+        }
+    }
+
+    /// Disable adaptive pacing; thresholds keep their last tuned values.
+    pub fn disable_adaptive_thresholds(&mut self) {
+        for shard in &self.shards {
+            shard.write().clear_adaptive();
+        }
     }
 
     pub fn collect_if_needed(&self) -> GCResult<usize> {
@@ -146,30 +398,52 @@ impl GarbageCollector {
             return Ok(0);
         }
 
-        let mut collector = self.collector.write();
-
-        for gen_idx in (0..3).rev() {
-            if collector
-                .generation_manager
-                .get_generation(gen_idx)
-                .map(|g| g.should_collect())
-                .unwrap_or(false)
-            {
-                return collector.collect_generation(gen_idx);
+        let mut collected = 0;
+        for shard in &self.shards {
+            let mut collector = shard.write();
+
+            for gen_idx in (0..3).rev() {
+                if collector
+                    .generation_manager
+                    .get_generation(gen_idx)
+                    .map(|g| g.should_collect())
+                    .unwrap_or(false)
+                {
+                    collected += collector.collect_generation(gen_idx)?;
+                    break;
+                }
             }
         }
 
-        Ok(0)
+        Ok(collected)
+    }
+
+    /// Pop the next queued uncollectable object, scanning shards in order.
+    /// Each call transfers one object out of its shard's finalizer queue;
+    /// nothing is cloned. Returns `None` once every queue is empty.
+    pub fn next_garbage(&self) -> Option<PyObject> {
+        self.shards
+            .iter()
+            .find_map(|shard| shard.write().pop_uncollectable())
     }
 
-    pub fn get_uncollectable(&self) -> Vec<PyObject> {
-        let collector = self.collector.read();
-        collector.uncollectable.clone()
+    pub fn is_uncollectable(&self, obj_id: &ObjectId) -> bool {
+        self.shards
+            .iter()
+            .any(|shard| shard.read().is_uncollectable(obj_id))
+    }
+
+    pub fn uncollectable_count(&self) -> usize {
+        self.shards
+            .iter()
+            .map(|shard| shard.read().uncollectable_count())
+            .sum()
     }
 
     pub fn clear_uncollectable(&self) {
-        let mut collector = self.collector.write();
-        collector.uncollectable.clear();
+        for shard in &self.shards {
+            shard.write().clear_uncollectable();
+        }
     }
 }
 
@@ -179,6 +453,12 @@ impl Default for GarbageCollector {
     }
 }
 
+impl Drop for GarbageCollector {
+    fn drop(&mut self) {
+        self.stop_background_collector();
+    }
+}
+
 pub mod global {
     use super::*;
     use parking_lot::RwLock;
@@ -201,19 +481,61 @@ pub mod global {
         }
     }
 
+    /// Objects buffered per thread before the nursery flushes into the
+    /// sharded collector in one `track_bulk` call.
+    pub const NURSERY_CAPACITY: usize = 2048;
+
+    thread_local! {
+        static NURSERY: std::cell::RefCell<Vec<PyObject>> =
+            std::cell::RefCell::new(Vec::new());
+    }
+
     pub fn track(obj: PyObject) -> GCResult<()> {
         let binding = get_gc();
-        let mut gc = binding.write();
+        let gc = binding.read();
         gc.track(obj)
     }
 
+    /// Track through the calling thread's generation-0 nursery: the object is
+    /// buffered with no locking or atomics and the whole batch merges into
+    /// the collector once `NURSERY_CAPACITY` accumulates, amortizing the
+    /// cross-thread synchronization the same way `track_bulk` does.
+    pub fn track_buffered(obj: PyObject) -> GCResult<()> {
+        let full = NURSERY.with(|nursery| {
+            let mut nursery = nursery.borrow_mut();
+            nursery.push(obj);
+            nursery.len() >= NURSERY_CAPACITY
+        });
+
+        if full { flush_nursery() } else { Ok(()) }
+    }
+
+    /// Flush the calling thread's nursery into the collector. Call before a
+    /// manual collection or when a worker thread winds down.
+    pub fn flush_nursery() -> GCResult<()> {
+        let batch = NURSERY.with(|nursery| std::mem::take(&mut *nursery.borrow_mut()));
+        if batch.is_empty() {
+            return Ok(());
+        }
+
+        let binding = get_gc();
+        let gc = binding.read();
+        gc.track_bulk(batch)
+    }
+
+    /// Number of objects waiting in the calling thread's nursery.
+    pub fn nursery_len() -> usize {
+        NURSERY.with(|nursery| nursery.borrow().len())
+    }
+
     pub fn untrack(obj_id: &ObjectId) -> GCResult<()> {
         let binding = get_gc();
-        let mut gc = binding.write();
+        let gc = binding.read();
         gc.untrack(obj_id)
     }
 
     pub fn collect() -> GCResult<usize> {
+        flush_nursery()?;
         let binding = get_gc();
         let gc = binding.read();
         gc.collect()
@@ -264,6 +586,198 @@ mod tests {
         assert_eq!(gc.get_threshold(0), Some(1000));
     }
 
+    #[test]
+    fn test_set_threshold_reaches_generations() {
+        let mut gc = GarbageCollector::with_shards(1);
+        gc.set_threshold(0, 5).unwrap();
+
+        for i in 0..5 {
+            let obj = PyObject::new("test".to_string(), ObjectData::Integer(i));
+            gc.track(obj).unwrap();
+        }
+
+        // The lowered threshold must be live in the generation, not just
+        // recorded in the facade.
+        assert!(gc.needs_collection());
+    }
+
+    #[test]
+    fn test_adaptive_thresholds_tune_and_pin() {
+        let mut gc = GarbageCollector::with_shards(1);
+
+        // A zero-ish target means every collection exceeds the overhead
+        // budget, so the tuner must back thresholds off.
+        gc.enable_adaptive_thresholds(1e-9);
+
+        let before = gc.get_threshold(0).unwrap();
+        let obj = PyObject::new("test".to_string(), ObjectData::Integer(1));
+        gc.track(obj).unwrap();
+        gc.collect().unwrap();
+        assert!(gc.get_threshold(0).unwrap() > before);
+
+        // Manual override pins the generation against further tuning.
+        gc.set_threshold(0, 123).unwrap();
+        let obj = PyObject::new("test".to_string(), ObjectData::Integer(2));
+        gc.track(obj).unwrap();
+        gc.collect().unwrap();
+        assert_eq!(gc.get_threshold(0), Some(123));
+    }
+
+    #[test]
+    fn test_nursery_buffered_tracking() {
+        let before = global::get_gc().read().get_count();
+
+        let obj = PyObject::new("test".to_string(), ObjectData::Integer(1));
+        global::track_buffered(obj).unwrap();
+        assert_eq!(global::nursery_len(), 1);
+
+        global::flush_nursery().unwrap();
+        assert_eq!(global::nursery_len(), 0);
+        assert_eq!(global::get_gc().read().get_count(), before + 1);
+    }
+
+    #[test]
+    fn test_background_collector() {
+        let mut gc = GarbageCollector::with_shards(2);
+        gc.set_threshold(0, 10).unwrap();
+
+        gc.start_background_collector(1).unwrap();
+        assert!(gc.has_background_collector());
+
+        // Starting twice is an error while one is running.
+        assert!(gc.start_background_collector(1).is_err());
+
+        // Enough garbage to push every shard past its generation-0 threshold,
+        // so the background thread has collection work to discover, plus a
+        // handful of live objects it must leave alone.
+        for i in 0..2000 {
+            let mut obj = PyObject::new("test".to_string(), ObjectData::Integer(i));
+            obj.set_refcount(0);
+            gc.track(obj).unwrap();
+        }
+        for i in 0..50 {
+            let obj = PyObject::new("live".to_string(), ObjectData::Integer(i));
+            gc.track(obj).unwrap();
+        }
+
+        let deadline = std::time::Instant::now() + std::time::Duration::from_secs(5);
+        while gc.get_count() > 50 && std::time::Instant::now() < deadline {
+            std::thread::sleep(std::time::Duration::from_millis(5));
+        }
+        assert_eq!(gc.get_count(), 50);
+
+        gc.stop_background_collector();
+        assert!(!gc.has_background_collector());
+    }
+
+    #[test]
+    fn test_incremental_collection() {
+        let gc = GarbageCollector::new();
+
+        // 400 dead objects interleaved with 100 externally referenced ones.
+        for i in 0..500 {
+            let mut obj = PyObject::new("test".to_string(), ObjectData::Integer(i));
+            if i % 5 != 0 {
+                obj.set_refcount(0);
+            }
+            gc.track(obj).unwrap();
+        }
+        assert_eq!(gc.get_count(), 500);
+
+        // A generous budget should finish the whole cycle in one call,
+        // sweeping the garbage and leaving the referenced objects tracked.
+        let collected = gc
+            .collect_with_budget(std::time::Duration::from_millis(100))
+            .unwrap();
+        assert_eq!(collected, 400);
+        assert_eq!(gc.get_count(), 100);
+    }
+
+    #[test]
+    fn test_incremental_collection_resumes() {
+        let gc = GarbageCollector::with_shards(1);
+
+        for i in 0..3000 {
+            let mut obj = PyObject::new("test".to_string(), ObjectData::Integer(i));
+            obj.set_refcount(0);
+            gc.track(obj).unwrap();
+        }
+
+        // Zero budget: one slice per call, so the cycle spans several calls
+        // and resumes from the persisted collecting bits.
+        let mut total = 0;
+        for _ in 0..10 {
+            total += gc.collect_with_budget(std::time::Duration::ZERO).unwrap();
+            if gc.get_count() == 0 {
+                break;
+            }
+        }
+
+        assert_eq!(total, 3000);
+        assert_eq!(gc.get_count(), 0);
+    }
+
+    #[test]
+    fn test_incremental_collection_splits_dead_cycle() {
+        let gc = GarbageCollector::with_shards(1);
+
+        // 1023 dead singletons plus an a <-> b cycle: one short of the
+        // 1024-object slice budget, so the first slice boundary lands
+        // between the cycle's members.
+        for i in 0..1023 {
+            let mut obj = PyObject::new("test".to_string(), ObjectData::Integer(i));
+            obj.set_refcount(0);
+            gc.track(obj).unwrap();
+        }
+        let b_placeholder = PyObject::new("cycle".to_string(), ObjectData::None);
+        let b_id = b_placeholder.id;
+        let a = PyObject::new("cycle".to_string(), ObjectData::List(vec![b_id]));
+        let a_id = a.id;
+        let mut b = b_placeholder;
+        b.data = ObjectData::List(vec![a_id]);
+        gc.track(a).unwrap();
+        gc.track(b).unwrap();
+        assert_eq!(gc.get_count(), 1025);
+
+        // The slice that frees the first cycle member gives the second its
+        // reference back, so the following slice sees it unreferenced and
+        // sweeps it instead of leaking it as externally referenced.
+        let mut total = 0;
+        for _ in 0..10 {
+            total += gc.collect_with_budget(std::time::Duration::ZERO).unwrap();
+            if gc.get_count() == 0 {
+                break;
+            }
+        }
+
+        assert_eq!(total, 1025);
+        assert_eq!(gc.get_count(), 0);
+    }
+
+    #[test]
+    fn test_sharded_tracking() {
+        let gc = std::sync::Arc::new(GarbageCollector::with_shards(4));
+        assert_eq!(gc.shard_count(), 4);
+
+        let handles: Vec<_> = (0..4)
+            .map(|_| {
+                let gc = gc.clone();
+                std::thread::spawn(move || {
+                    for i in 0..100 {
+                        let obj = PyObject::new("test".to_string(), ObjectData::Integer(i));
+                        gc.track(obj).unwrap();
+                    }
+                })
+            })
+            .collect();
+
+        for handle in handles {
+            handle.join().unwrap();
+        }
+
+        assert_eq!(gc.get_count(), 400);
+    }
+
     #[test]
     fn test_collection() {
         let gc = GarbageCollector::new();
@@ -271,4 +785,23 @@ mod tests {
         assert!(gc.collect().is_ok());
         assert_eq!(gc.get_count(), 0);
     }
+
+    #[test]
+    fn test_finalizer_queue_cursor() {
+        let gc = GarbageCollector::with_shards(1);
+
+        let obj = PyObject::new_with_finalizer("test".to_string(), ObjectData::Integer(1));
+        let obj_id = obj.id;
+        gc.track(obj).unwrap();
+
+        assert_eq!(gc.uncollectable_count(), 1);
+        assert!(gc.is_uncollectable(&obj_id));
+
+        // The cursor transfers one object per call; no queue clone.
+        let popped = gc.next_garbage().expect("queued finalizer object");
+        assert_eq!(popped.id, obj_id);
+        assert_eq!(gc.uncollectable_count(), 0);
+        assert!(!gc.is_uncollectable(&obj_id));
+        assert!(gc.next_garbage().is_none());
+    }
 }
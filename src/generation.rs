@@ -1,18 +1,18 @@
 use crate::GCResult;
 use crate::error::GCError;
-use crate::object::{ObjectId, PyObject};
+use crate::object::{ObjectId, PyGCHead};
 
 #[derive(Debug)]
 pub struct Generation {
     pub count: usize,
     pub threshold: usize,
-    pub head: crate::object::PyGCHead,
+    pub head: Box<PyGCHead>,
 }
 
 impl Generation {
     pub fn new(threshold: usize) -> Self {
-        let mut head = crate::object::PyGCHead::new();
-        let head_ptr = &mut head as *mut crate::object::PyGCHead;
+        let mut head = Box::new(PyGCHead::new());
+        let head_ptr = head.as_mut() as *mut PyGCHead;
         head.set_next(head_ptr);
         head.set_prev(head_ptr);
 
@@ -23,14 +23,28 @@ impl Generation {
         }
     }
 
-    pub fn add_object(&mut self, _obj: PyObject) -> GCResult<()> {
-        self.count += 1;
-        Ok(())
+    /// Pointer to this generation's list sentinel. The sentinel is boxed so the
+    /// pointer stays valid even when the `Generation` itself is moved.
+    pub fn head_ptr(&mut self) -> *mut PyGCHead {
+        self.head.as_mut() as *mut PyGCHead
     }
 
-    pub fn add_object_fast(&mut self, _obj_id: ObjectId) -> GCResult<()> {
+    /// Link an object's `PyGCHead` at the tail of this generation's list.
+    ///
+    /// # Safety
+    ///
+    /// - `node` must point to a live `PyGCHead` with a stable address
+    /// - `node` must not already be linked into any generation list
+    pub unsafe fn link(&mut self, node: *mut PyGCHead) {
+        let head = self.head_ptr();
+        unsafe {
+            let tail = (*head).get_prev();
+            (*node).set_prev(tail);
+            (*node).set_next(head);
+            (*tail).set_next(node);
+            (*head).set_prev(node);
+        }
         self.count += 1;
-        Ok(())
     }
 
     pub fn remove_object(&mut self, _obj_id: &ObjectId) -> GCResult<()> {
@@ -44,7 +58,17 @@ impl Generation {
         self.count >= self.threshold
     }
 
+    pub fn is_empty(&mut self) -> bool {
+        let head = self.head_ptr();
+        unsafe { (*head).get_next() == head }
+    }
+
     pub fn clear(&mut self) {
+        let head = self.head_ptr();
+        unsafe {
+            (*head).set_next(head);
+            (*head).set_prev(head);
+        }
         self.count = 0;
     }
 }
@@ -71,17 +95,15 @@ impl GenerationManager {
         Self { generations }
     }
 
-    pub fn add_to_generation0(&mut self, obj: PyObject) -> GCResult<()> {
-        if let Some(generation) = self.generations.get_mut(0) {
-            generation.add_object(obj)
-        } else {
-            Err(GCError::Internal("Generation 0 not found".to_string()))
-        }
-    }
-
-    pub fn add_to_generation0_fast(&mut self, obj_id: ObjectId) -> GCResult<()> {
+    /// Link a freshly tracked object into generation 0.
+    ///
+    /// # Safety
+    ///
+    /// Same contract as [`Generation::link`].
+    pub unsafe fn link_to_generation0(&mut self, node: *mut PyGCHead) -> GCResult<()> {
         if let Some(generation) = self.generations.get_mut(0) {
-            generation.add_object_fast(obj_id)
+            unsafe { generation.link(node) };
+            Ok(())
         } else {
             Err(GCError::Internal("Generation 0 not found".to_string()))
         }
@@ -92,10 +114,37 @@ impl GenerationManager {
             return Err(GCError::Internal("Invalid generation index".to_string()));
         }
 
+        if from_gen == to_gen {
+            return Ok(());
+        }
+
+        let from_head = self.generations[from_gen].head_ptr();
+        let to_head = self.generations[to_gen].head_ptr();
+
+        unsafe {
+            let first = (*from_head).get_next();
+            if first != from_head {
+                let last = (*from_head).get_prev();
+                let to_tail = (*to_head).get_prev();
+
+                (*to_tail).set_next(first);
+                (*first).set_prev(to_tail);
+                (*last).set_next(to_head);
+                (*to_head).set_prev(last);
+
+                (*from_head).set_next(from_head);
+                (*from_head).set_prev(from_head);
+            }
+        }
+
         let from_count = self.generations[from_gen].count;
-        self.generations[from_gen].clear();
+        self.generations[from_gen].count = 0;
         self.generations[to_gen].count += from_count;
 
+        if to_gen > from_gen && from_count > 0 {
+            crate::stats::CollectionTelemetry::global().record_promotions(to_gen, from_count);
+        }
+
         Ok(())
     }
 
@@ -0,0 +1,87 @@
+use parking_lot::RwLock;
+use std::collections::HashMap;
+use std::sync::OnceLock;
+
+/// Index into the global type-name intern table.
+///
+/// Objects store this 4-byte id instead of an owned `String`, so tracking 30M
+/// "dict"/"list"/"MyClass" instances shares one interned copy per distinct
+/// name instead of duplicating gigabytes of heap strings.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct TypeId(pub u32);
+
+struct InternTable {
+    ids: HashMap<&'static str, u32>,
+    names: Vec<&'static str>,
+}
+
+fn table() -> &'static RwLock<InternTable> {
+    static TABLE: OnceLock<RwLock<InternTable>> = OnceLock::new();
+    TABLE.get_or_init(|| {
+        RwLock::new(InternTable {
+            ids: HashMap::new(),
+            names: Vec::new(),
+        })
+    })
+}
+
+/// Intern a type name, returning its stable `TypeId`. Known names resolve
+/// under a read lock; a new name takes the write lock once and is leaked so
+/// resolved `&'static str` references stay valid for the process lifetime.
+pub fn intern(name: &str) -> TypeId {
+    {
+        let table = table().read();
+        if let Some(&id) = table.ids.get(name) {
+            return TypeId(id);
+        }
+    }
+
+    let mut table = table().write();
+    if let Some(&id) = table.ids.get(name) {
+        return TypeId(id);
+    }
+
+    let leaked: &'static str = Box::leak(name.to_string().into_boxed_str());
+    let id = table.names.len() as u32;
+    table.names.push(leaked);
+    table.ids.insert(leaked, id);
+    TypeId(id)
+}
+
+/// Copy of the full intern table in id order, for serializers that emit the
+/// table up front and refer to types by index afterwards.
+pub fn names() -> Vec<&'static str> {
+    table().read().names.clone()
+}
+
+/// Resolve an interned id back to its name.
+pub fn resolve(type_id: TypeId) -> &'static str {
+    table()
+        .read()
+        .names
+        .get(type_id.0 as usize)
+        .copied()
+        .unwrap_or("unknown")
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_intern_dedupes() {
+        let a = intern("some_unique_test_type");
+        let b = intern("some_unique_test_type");
+        assert_eq!(a, b);
+        assert_eq!(resolve(a), "some_unique_test_type");
+    }
+
+    #[test]
+    fn test_distinct_names_get_distinct_ids() {
+        let a = intern("intern_test_type_a");
+        let b = intern("intern_test_type_b");
+        assert_ne!(a, b);
+        assert_eq!(resolve(a), "intern_test_type_a");
+        assert_eq!(resolve(b), "intern_test_type_b");
+    }
+}
@@ -6,10 +6,15 @@
 
 pub mod collector;
 pub mod error;
+pub mod events;
 pub mod ffi;
 pub mod gc;
+pub mod intern;
 pub mod generation;
 pub mod object;
+pub mod slab;
+pub mod snapshot;
+pub mod stats;
 pub mod traversal;
 
 #[derive(Debug, Clone)]
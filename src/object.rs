@@ -1,3 +1,4 @@
+use crate::intern::{self, TypeId};
 use std::ffi::c_void;
 use std::hash::{Hash, Hasher};
 
@@ -12,13 +13,34 @@ impl Default for ObjectId {
     }
 }
 
+/// Ids leased per thread from the global allocator in one atomic bump.
+const ID_BLOCK_SIZE: usize = 4096;
+
 impl ObjectId {
+    /// Allocate a fresh id. Each thread leases a block of `ID_BLOCK_SIZE`
+    /// ids from a single global atomic and hands them out with a plain
+    /// thread-local increment, so the shared cache line is only touched once
+    /// per block instead of once per object.
     pub fn new() -> Self {
-        static mut COUNTER: usize = 0;
-        unsafe {
-            COUNTER += 1;
-            Self { id: COUNTER }
+        use std::cell::Cell;
+        use std::sync::atomic::{AtomicUsize, Ordering};
+
+        static NEXT_BLOCK: AtomicUsize = AtomicUsize::new(1);
+
+        thread_local! {
+            // (next id, end of leased block)
+            static CURSOR: Cell<(usize, usize)> = const { Cell::new((0, 0)) };
         }
+
+        CURSOR.with(|cursor| {
+            let (mut next, mut end) = cursor.get();
+            if next == end {
+                next = NEXT_BLOCK.fetch_add(ID_BLOCK_SIZE, Ordering::Relaxed);
+                end = next + ID_BLOCK_SIZE;
+            }
+            cursor.set((next + 1, end));
+            Self { id: next }
+        })
     }
 
     pub fn as_usize(&self) -> usize {
@@ -48,11 +70,11 @@ impl PyGCHead {
     }
 
     pub fn set_next(&mut self, next: *mut PyGCHead) {
-        self._gc_next = next as usize;
+        self._gc_next = (self._gc_next & 0x7) | (next as usize);
     }
 
     pub fn get_next(&self) -> *mut PyGCHead {
-        self._gc_next as *mut PyGCHead
+        (self._gc_next & !0x7) as *mut PyGCHead
     }
 
     pub fn set_prev(&mut self, prev: *mut PyGCHead) {
@@ -103,22 +125,76 @@ impl PyGCHead {
         (self._gc_next & 0x1) != 0
     }
 
+    /// Object age in collections survived, packed into the spare `_gc_next`
+    /// tag bits (pointers are 8-byte aligned, bit 0 is the unreachable flag).
+    /// Saturates at 3; promotion fires well before that.
+    pub fn age(&self) -> usize {
+        (self._gc_next & 0x6) >> 1
+    }
+
+    pub fn set_age(&mut self, age: usize) {
+        self._gc_next = (self._gc_next & !0x6) | (age.min(3) << 1);
+    }
+
+    /// Increment the age (saturating) and return the new value.
+    pub fn bump_age(&mut self) -> usize {
+        let age = (self.age() + 1).min(3);
+        self.set_age(age);
+        age
+    }
+
     pub fn is_tracked(&self) -> bool {
-        self._gc_next != 0
+        (self._gc_next & !0x7) != 0
+    }
+
+    /// Unlink a node from whatever generation list currently contains it.
+    ///
+    /// # Safety
+    ///
+    /// - `node` must point to a live `PyGCHead` that is linked into a generation list
+    /// - The neighbouring nodes reachable through `node` must also be live
+    pub unsafe fn unlink(node: *mut PyGCHead) {
+        unsafe {
+            let prev = (*node).get_prev();
+            let next = (*node).get_next();
+            (*prev).set_next(next);
+            (*next).set_prev(prev);
+            (*node).set_next(std::ptr::null_mut());
+            (*node).set_prev(std::ptr::null_mut());
+        }
     }
 }
 
+/// Object payload. Containers hold `ObjectId` handles resolved through the
+/// object table rather than child objects by value, so cloning a `PyObject`
+/// copies a flat index vector instead of an ownership tree and graph edges
+/// are index lookups.
 #[derive(Debug, Clone, PartialEq)]
 pub enum ObjectData {
     Integer(i64),
     Float(f64),
     String(String),
-    List(Vec<PyObject>),
-    Dict(Vec<(PyObject, PyObject)>),
+    List(Vec<ObjectId>),
+    Dict(Vec<(ObjectId, ObjectId)>),
     Custom(*mut c_void),
     None,
 }
 
+impl ObjectData {
+    /// Child handles referenced by this payload, in container order (dict
+    /// entries yield key then value). Scalars yield nothing.
+    pub fn children(&self) -> Vec<ObjectId> {
+        match self {
+            ObjectData::List(items) => items.clone(),
+            ObjectData::Dict(entries) => entries
+                .iter()
+                .flat_map(|(key, value)| [*key, *value])
+                .collect(),
+            _ => Vec::new(),
+        }
+    }
+}
+
 unsafe impl Send for ObjectData {}
 unsafe impl Sync for ObjectData {}
 
@@ -126,7 +202,7 @@ unsafe impl Sync for ObjectData {}
 #[derive(Debug, Clone)]
 pub struct PyObject {
     pub gc_head: PyGCHead,
-    pub name: String,
+    pub type_id: TypeId,
     pub data: ObjectData,
     pub refcount: usize,
     pub gc_tracked: bool,
@@ -141,7 +217,7 @@ impl PyObject {
     pub fn new(name: String, data: ObjectData) -> Self {
         Self {
             gc_head: PyGCHead::new(),
-            name,
+            type_id: intern::intern(&name),
             data,
             refcount: 1,
             gc_tracked: false,
@@ -153,7 +229,7 @@ impl PyObject {
     pub fn new_ffi(name: &str, data: ObjectData, _ptr: *mut c_void) -> Self {
         Self {
             gc_head: PyGCHead::new(),
-            name: name.to_string(),
+            type_id: intern::intern(name),
             data,
             refcount: 1,
             gc_tracked: false,
@@ -162,10 +238,22 @@ impl PyObject {
         }
     }
 
+    /// Reinitialize a recycled record in place, as `new_ffi` would construct
+    /// it, so pooled records skip the allocator entirely.
+    pub fn reinit_ffi(&mut self, name: &str, data: ObjectData) {
+        self.gc_head = PyGCHead::new();
+        self.type_id = intern::intern(name);
+        self.data = data;
+        self.refcount = 1;
+        self.gc_tracked = false;
+        self.has_finalizer = false;
+        self.id = ObjectId::new();
+    }
+
     pub fn new_with_finalizer(name: String, data: ObjectData) -> Self {
         Self {
             gc_head: PyGCHead::new(),
-            name,
+            type_id: intern::intern(&name),
             data,
             refcount: 1,
             gc_tracked: false,
@@ -174,6 +262,11 @@ impl PyObject {
         }
     }
 
+    /// Resolve this object's type name through the global intern table.
+    pub fn type_name(&self) -> &'static str {
+        intern::resolve(self.type_id)
+    }
+
     pub fn get_refcount(&self) -> usize {
         self.refcount
     }
@@ -278,3 +371,45 @@ impl Drop for PyObjectPtr {
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::collections::HashSet;
+
+    #[test]
+    fn test_container_payloads_hold_handles() {
+        let a = PyObject::new("int".to_string(), ObjectData::Integer(1));
+        let b = PyObject::new("int".to_string(), ObjectData::Integer(2));
+
+        let list = PyObject::new("list".to_string(), ObjectData::List(vec![a.id, b.id]));
+        assert_eq!(list.data.children(), vec![a.id, b.id]);
+
+        let dict = PyObject::new("dict".to_string(), ObjectData::Dict(vec![(a.id, b.id)]));
+        assert_eq!(dict.data.children(), vec![a.id, b.id]);
+
+        // Cloning a container copies the handle vector, not child objects.
+        let clone = list.clone();
+        assert_eq!(clone.data, list.data);
+    }
+
+    #[test]
+    fn test_object_id_unique_across_threads() {
+        let handles: Vec<_> = (0..4)
+            .map(|_| {
+                std::thread::spawn(|| {
+                    (0..ID_BLOCK_SIZE * 2)
+                        .map(|_| ObjectId::new().as_usize())
+                        .collect::<Vec<_>>()
+                })
+            })
+            .collect();
+
+        let mut seen = HashSet::new();
+        for handle in handles {
+            for id in handle.join().unwrap() {
+                assert!(seen.insert(id), "duplicate ObjectId {id}");
+            }
+        }
+    }
+}
@@ -0,0 +1,321 @@
+use crate::object::{ObjectId, PyGCHead, PyObject};
+use std::collections::HashMap;
+
+/// Number of object slots per arena chunk. Chunks are boxed and never move or
+/// shrink, so a slot address (and the `PyGCHead` inside it) is stable for the
+/// lifetime of the slab.
+pub const CHUNK_SIZE: usize = 4096;
+
+/// Slab-backed object table.
+///
+/// Objects live inline in fixed-size chunks, so a collection walk streams
+/// through contiguous memory instead of chasing one heap allocation per
+/// object the way the old `HashMap<ObjectId, Box<PyObject>>` layout did.
+/// Each object is addressed by a stable `u32` slot index; freed slots are
+/// recycled through a free list. An id index maps the externally visible
+/// `ObjectId` to its slot.
+#[derive(Debug)]
+pub struct ObjectSlab {
+    chunks: Vec<Box<[Option<PyObject>]>>,
+    free: Vec<u32>,
+    slots: HashMap<ObjectId, u32>,
+    len: usize,
+    /// Dense per-slot refcount column (SoA). Kept in sync on insert/remove
+    /// and through [`set_refcount`](Self::set_refcount), so the
+    /// subtract-references phase of a collection seeds its working copy with
+    /// one bulk memcpy instead of unpacking tagged `PyGCHead` words per
+    /// object.
+    refcounts: Vec<i64>,
+    /// Scratch column for the subtract-references phase; contiguous `i64`s so
+    /// the decrement pass vectorizes.
+    gc_refs: Vec<i64>,
+    /// Dense per-slot owning-generation column, written by the collector when
+    /// it links or promotes a node, so untrack can give the count back to the
+    /// right generation without walking the lists.
+    gens: Vec<u8>,
+}
+
+impl Default for ObjectSlab {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl ObjectSlab {
+    pub fn new() -> Self {
+        Self {
+            chunks: Vec::new(),
+            free: Vec::new(),
+            slots: HashMap::new(),
+            len: 0,
+            refcounts: Vec::new(),
+            gc_refs: Vec::new(),
+            gens: Vec::new(),
+        }
+    }
+
+    fn grow(&mut self) {
+        let base = (self.chunks.len() * CHUNK_SIZE) as u32;
+        let chunk: Box<[Option<PyObject>]> = (0..CHUNK_SIZE).map(|_| None).collect();
+        self.chunks.push(chunk);
+        self.refcounts.resize(self.chunks.len() * CHUNK_SIZE, 0);
+        self.gens.resize(self.chunks.len() * CHUNK_SIZE, 0);
+
+        for offset in (0..CHUNK_SIZE as u32).rev() {
+            self.free.push(base + offset);
+        }
+    }
+
+    /// Insert an object and return its slot index.
+    pub fn insert(&mut self, obj: PyObject) -> u32 {
+        if self.free.is_empty() {
+            self.grow();
+        }
+
+        let slot = self.free.pop().expect("free list refilled by grow");
+        let obj_id = obj.id;
+        self.refcounts[slot as usize] = obj.refcount as i64;
+        self.gens[slot as usize] = 0;
+        self.chunks[slot as usize / CHUNK_SIZE][slot as usize % CHUNK_SIZE] = Some(obj);
+        self.slots.insert(obj_id, slot);
+        self.len += 1;
+        slot
+    }
+
+    pub fn remove(&mut self, obj_id: &ObjectId) -> Option<PyObject> {
+        let slot = self.slots.remove(obj_id)?;
+        let obj = self.chunks[slot as usize / CHUNK_SIZE][slot as usize % CHUNK_SIZE].take();
+        if obj.is_some() {
+            self.refcounts[slot as usize] = 0;
+            self.free.push(slot);
+            self.len -= 1;
+        }
+        obj
+    }
+
+    /// Update an object's refcount through the table so the dense refcount
+    /// column stays in sync. Returns false if the id is not present.
+    pub fn set_refcount(&mut self, obj_id: &ObjectId, refcount: usize) -> bool {
+        let Some(&slot) = self.slots.get(obj_id) else {
+            return false;
+        };
+
+        if let Some(obj) = self.get_slot_mut(slot) {
+            obj.refcount = refcount;
+        }
+        self.refcounts[slot as usize] = refcount as i64;
+        true
+    }
+
+    /// Subtract one stored reference, keeping the object and the dense
+    /// column in sync. Saturates at zero. Returns false if the id is not
+    /// present.
+    pub fn dec_refcount(&mut self, obj_id: &ObjectId) -> bool {
+        let Some(&slot) = self.slots.get(obj_id) else {
+            return false;
+        };
+
+        if let Some(obj) = self.get_slot_mut(slot) {
+            obj.refcount = obj.refcount.saturating_sub(1);
+        }
+        self.refcounts[slot as usize] = (self.refcounts[slot as usize] - 1).max(0);
+        true
+    }
+
+    /// Generation currently owning an object's `PyGCHead`. Fresh inserts
+    /// start in generation 0; the collector updates this on promotion.
+    pub fn generation_of(&self, obj_id: &ObjectId) -> Option<usize> {
+        let slot = self.slots.get(obj_id)?;
+        Some(self.gens[*slot as usize] as usize)
+    }
+
+    /// Record which generation's list an object's `PyGCHead` was linked
+    /// into. Returns false if the id is not present.
+    pub fn set_generation(&mut self, obj_id: &ObjectId, generation: usize) -> bool {
+        let Some(&slot) = self.slots.get(obj_id) else {
+            return false;
+        };
+
+        self.gens[slot as usize] = generation as u8;
+        true
+    }
+
+    pub fn contains(&self, obj_id: &ObjectId) -> bool {
+        self.slots.contains_key(obj_id)
+    }
+
+    pub fn slot_of(&self, obj_id: &ObjectId) -> Option<u32> {
+        self.slots.get(obj_id).copied()
+    }
+
+    pub fn get(&self, obj_id: &ObjectId) -> Option<&PyObject> {
+        let slot = self.slots.get(obj_id)?;
+        self.get_slot(*slot)
+    }
+
+    pub fn get_mut(&mut self, obj_id: &ObjectId) -> Option<&mut PyObject> {
+        let slot = *self.slots.get(obj_id)?;
+        self.get_slot_mut(slot)
+    }
+
+    pub fn get_slot(&self, slot: u32) -> Option<&PyObject> {
+        self.chunks
+            .get(slot as usize / CHUNK_SIZE)?
+            .get(slot as usize % CHUNK_SIZE)?
+            .as_ref()
+    }
+
+    pub fn get_slot_mut(&mut self, slot: u32) -> Option<&mut PyObject> {
+        self.chunks
+            .get_mut(slot as usize / CHUNK_SIZE)?
+            .get_mut(slot as usize % CHUNK_SIZE)?
+            .as_mut()
+    }
+
+    /// Pointer to the `PyGCHead` of the object in `slot`, for linking into a
+    /// generation list. Valid until the slot is removed.
+    pub fn head_ptr(&mut self, slot: u32) -> Option<*mut PyGCHead> {
+        self.get_slot_mut(slot)
+            .map(|obj| &mut obj.gc_head as *mut PyGCHead)
+    }
+
+    /// Total slot capacity (live + free); columns and slot-indexed bitmaps
+    /// are sized to this.
+    pub fn capacity(&self) -> usize {
+        self.chunks.len() * CHUNK_SIZE
+    }
+
+    /// Seed the scratch `gc_refs` column for a subtract-references phase:
+    /// one bulk copy of the whole refcount column, no per-object unpacking.
+    pub fn copy_refcounts_to_gc_refs(&mut self) {
+        self.gc_refs.clear();
+        self.gc_refs.extend_from_slice(&self.refcounts);
+    }
+
+    pub fn gc_ref(&self, slot: u32) -> i64 {
+        self.gc_refs.get(slot as usize).copied().unwrap_or(0)
+    }
+
+    /// Subtract one reference from a slot's working count. The column is
+    /// contiguous `i64`s, so tight subtract loops over it vectorize.
+    #[inline(always)]
+    pub fn sub_gc_ref(&mut self, slot: u32) {
+        if let Some(refs) = self.gc_refs.get_mut(slot as usize) {
+            *refs -= 1;
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    pub fn clear(&mut self) {
+        self.chunks.clear();
+        self.free.clear();
+        self.slots.clear();
+        self.len = 0;
+        self.refcounts.clear();
+        self.gc_refs.clear();
+        self.gens.clear();
+    }
+
+    /// Iterate over live objects in slot order, streaming chunk by chunk.
+    pub fn iter(&self) -> impl Iterator<Item = &PyObject> {
+        self.chunks
+            .iter()
+            .flat_map(|chunk| chunk.iter().filter_map(|slot| slot.as_ref()))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::object::ObjectData;
+
+    #[test]
+    fn test_insert_remove() {
+        let mut slab = ObjectSlab::new();
+
+        let obj = PyObject::new("test".to_string(), ObjectData::Integer(1));
+        let obj_id = obj.id;
+
+        let slot = slab.insert(obj);
+        assert_eq!(slab.len(), 1);
+        assert!(slab.contains(&obj_id));
+        assert_eq!(slab.slot_of(&obj_id), Some(slot));
+
+        let removed = slab.remove(&obj_id);
+        assert!(removed.is_some());
+        assert!(slab.is_empty());
+        assert!(!slab.contains(&obj_id));
+    }
+
+    #[test]
+    fn test_slot_reuse() {
+        let mut slab = ObjectSlab::new();
+
+        let obj1 = PyObject::new("a".to_string(), ObjectData::Integer(1));
+        let id1 = obj1.id;
+        let slot1 = slab.insert(obj1);
+        slab.remove(&id1);
+
+        let obj2 = PyObject::new("b".to_string(), ObjectData::Integer(2));
+        let slot2 = slab.insert(obj2);
+
+        assert_eq!(slot1, slot2);
+    }
+
+    #[test]
+    fn test_refcount_column_stays_in_sync() {
+        let mut slab = ObjectSlab::new();
+
+        let obj = PyObject::new("test".to_string(), ObjectData::Integer(1));
+        let obj_id = obj.id;
+        let slot = slab.insert(obj);
+
+        slab.copy_refcounts_to_gc_refs();
+        assert_eq!(slab.gc_ref(slot), 1);
+
+        assert!(slab.set_refcount(&obj_id, 5));
+        slab.copy_refcounts_to_gc_refs();
+        assert_eq!(slab.gc_ref(slot), 5);
+
+        assert!(slab.dec_refcount(&obj_id));
+        assert_eq!(slab.get(&obj_id).unwrap().refcount, 4);
+        slab.copy_refcounts_to_gc_refs();
+        assert_eq!(slab.gc_ref(slot), 4);
+        assert!(slab.set_refcount(&obj_id, 5));
+        slab.copy_refcounts_to_gc_refs();
+
+        slab.sub_gc_ref(slot);
+        slab.sub_gc_ref(slot);
+        assert_eq!(slab.gc_ref(slot), 3);
+
+        slab.remove(&obj_id);
+        slab.copy_refcounts_to_gc_refs();
+        assert_eq!(slab.gc_ref(slot), 0);
+    }
+
+    #[test]
+    fn test_stable_addresses_across_growth() {
+        let mut slab = ObjectSlab::new();
+
+        let obj = PyObject::new("anchor".to_string(), ObjectData::Integer(0));
+        let obj_id = obj.id;
+        let slot = slab.insert(obj);
+        let before = slab.head_ptr(slot).unwrap();
+
+        for i in 0..(CHUNK_SIZE * 2) {
+            let filler = PyObject::new("filler".to_string(), ObjectData::Integer(i as i64));
+            slab.insert(filler);
+        }
+
+        let after = slab.head_ptr(slot).unwrap();
+        assert_eq!(before, after);
+        assert!(slab.contains(&obj_id));
+    }
+}
@@ -0,0 +1,286 @@
+use std::sync::OnceLock;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::time::Duration;
+
+/// Power-of-two pause histogram buckets: bucket `i` counts pauses of
+/// `[2^(i-1), 2^i)` microseconds, with the last bucket absorbing the tail.
+pub const PAUSE_BUCKET_COUNT: usize = 16;
+
+/// Always-on collection telemetry. Every counter is a relaxed atomic, so
+/// recording on the collection path is a handful of uncontended adds and the
+/// instrumentation can stay enabled in production.
+#[derive(Debug, Default)]
+pub struct CollectionTelemetry {
+    pub collections: [AtomicU64; 3],
+    pub collected: [AtomicU64; 3],
+    pub promotions: [AtomicU64; 3],
+    pub pause_buckets: [AtomicU64; PAUSE_BUCKET_COUNT],
+    pub total_pause_us: AtomicU64,
+    pub max_pause_us: AtomicU64,
+}
+
+/// Plain-value copy of the telemetry counters for export.
+#[derive(Debug, Clone, Default)]
+pub struct TelemetrySnapshot {
+    pub collections: [u64; 3],
+    pub collected: [u64; 3],
+    pub promotions: [u64; 3],
+    pub pause_buckets: [u64; PAUSE_BUCKET_COUNT],
+    pub total_pause_us: u64,
+    pub max_pause_us: u64,
+}
+
+impl CollectionTelemetry {
+    pub fn global() -> &'static CollectionTelemetry {
+        static TELEMETRY: OnceLock<CollectionTelemetry> = OnceLock::new();
+        TELEMETRY.get_or_init(CollectionTelemetry::default)
+    }
+
+    pub fn record_collection(&self, generation: usize, collected: usize, pause: Duration) {
+        let generation = generation.min(2);
+        self.collections[generation].fetch_add(1, Ordering::Relaxed);
+        self.collected[generation].fetch_add(collected as u64, Ordering::Relaxed);
+
+        let pause_us = pause.as_micros() as u64;
+        let bucket = (64 - pause_us.leading_zeros() as usize).min(PAUSE_BUCKET_COUNT - 1);
+        self.pause_buckets[bucket].fetch_add(1, Ordering::Relaxed);
+        self.total_pause_us.fetch_add(pause_us, Ordering::Relaxed);
+        self.max_pause_us.fetch_max(pause_us, Ordering::Relaxed);
+
+        // Mirror into the shared-memory export if one is open; no-op otherwise.
+        shm::publish(&self.snapshot());
+    }
+
+    pub fn record_promotions(&self, to_generation: usize, count: usize) {
+        self.promotions[to_generation.min(2)].fetch_add(count as u64, Ordering::Relaxed);
+    }
+
+    pub fn snapshot(&self) -> TelemetrySnapshot {
+        let mut snapshot = TelemetrySnapshot::default();
+
+        for generation in 0..3 {
+            snapshot.collections[generation] = self.collections[generation].load(Ordering::Relaxed);
+            snapshot.collected[generation] = self.collected[generation].load(Ordering::Relaxed);
+            snapshot.promotions[generation] = self.promotions[generation].load(Ordering::Relaxed);
+        }
+        for bucket in 0..PAUSE_BUCKET_COUNT {
+            snapshot.pause_buckets[bucket] = self.pause_buckets[bucket].load(Ordering::Relaxed);
+        }
+        snapshot.total_pause_us = self.total_pause_us.load(Ordering::Relaxed);
+        snapshot.max_pause_us = self.max_pause_us.load(Ordering::Relaxed);
+
+        snapshot
+    }
+}
+
+pub mod shm {
+    //! Shared-memory stats export.
+    //!
+    //! A monitoring agent that scrapes `py_gc_get_stats` takes the collector
+    //! read lock and can stall behind a collection. Instead, the telemetry
+    //! block can be mirrored into a named POSIX shared-memory segment guarded
+    //! by a seqlock, so external processes mmap the segment and read the
+    //! counters with zero interaction with GC locks.
+
+    use super::{CollectionTelemetry, PAUSE_BUCKET_COUNT, TelemetrySnapshot};
+    use crate::GCResult;
+    use crate::error::GCError;
+    use parking_lot::Mutex;
+    use std::ffi::CString;
+    use std::ptr;
+    use std::sync::atomic::{AtomicPtr, AtomicU64, Ordering};
+
+    /// Layout of the shared segment. `seq` is the seqlock generation counter:
+    /// it is odd while a write is in flight. Readers load `seq`, retry while
+    /// it is odd, copy the payload, reload `seq`, and retry if it changed
+    /// underneath them.
+    #[repr(C)]
+    pub struct StatsShmBlock {
+        pub seq: AtomicU64,
+        pub collections: [u64; 3],
+        pub collected: [u64; 3],
+        pub promotions: [u64; 3],
+        pub pause_buckets: [u64; PAUSE_BUCKET_COUNT],
+        pub total_pause_us: u64,
+        pub max_pause_us: u64,
+    }
+
+    static SHM_BLOCK: AtomicPtr<StatsShmBlock> = AtomicPtr::new(ptr::null_mut());
+    // Collections on different shards can finish concurrently; the seqlock
+    // only tolerates one writer at a time.
+    static SHM_WRITER: Mutex<()> = Mutex::new(());
+
+    /// Open (creating if needed) the named POSIX shared-memory segment and
+    /// start mirroring the telemetry block into it after every collection.
+    pub fn open(name: &str) -> GCResult<()> {
+        if !SHM_BLOCK.load(Ordering::Acquire).is_null() {
+            return Err(GCError::Internal("Stats shm already open".to_string()));
+        }
+
+        let c_name =
+            CString::new(name).map_err(|_| GCError::Internal("Invalid shm name".to_string()))?;
+
+        unsafe {
+            let fd = libc::shm_open(c_name.as_ptr(), libc::O_CREAT | libc::O_RDWR, 0o644);
+            if fd < 0 {
+                return Err(GCError::Internal(format!("shm_open({name}) failed")));
+            }
+
+            let size = std::mem::size_of::<StatsShmBlock>();
+            if libc::ftruncate(fd, size as libc::off_t) != 0 {
+                libc::close(fd);
+                return Err(GCError::Internal(format!("ftruncate({name}) failed")));
+            }
+
+            let addr = libc::mmap(
+                ptr::null_mut(),
+                size,
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_SHARED,
+                fd,
+                0,
+            );
+            libc::close(fd);
+            if addr == libc::MAP_FAILED {
+                return Err(GCError::Internal(format!("mmap({name}) failed")));
+            }
+
+            let block = addr as *mut StatsShmBlock;
+            (*block).seq.store(0, Ordering::Release);
+            SHM_BLOCK.store(block, Ordering::Release);
+        }
+
+        // Seed the segment so scrapers see valid data before the first
+        // collection after opening.
+        publish(&CollectionTelemetry::global().snapshot());
+        Ok(())
+    }
+
+    /// Unmap the segment and stop publishing. The name is left linked so
+    /// already-attached readers keep their mapping; `shm_unlink` it separately
+    /// when the segment should disappear.
+    pub fn close() {
+        let block = SHM_BLOCK.swap(ptr::null_mut(), Ordering::AcqRel);
+        if !block.is_null() {
+            // Wait out any in-flight publish before unmapping.
+            let _writer = SHM_WRITER.lock();
+            unsafe {
+                libc::munmap(block as *mut libc::c_void, std::mem::size_of::<StatsShmBlock>());
+            }
+        }
+    }
+
+    /// Copy a telemetry snapshot into the segment under the seqlock. The
+    /// pointer is re-checked under the writer lock so `close` cannot unmap
+    /// the block while a publish is writing through it.
+    pub(crate) fn publish(snapshot: &TelemetrySnapshot) {
+        if SHM_BLOCK.load(Ordering::Relaxed).is_null() {
+            return;
+        }
+
+        let _writer = SHM_WRITER.lock();
+        let block = SHM_BLOCK.load(Ordering::Acquire);
+        if block.is_null() {
+            return;
+        }
+
+        unsafe {
+            (*block).seq.fetch_add(1, Ordering::AcqRel);
+            ptr::write_volatile(ptr::addr_of_mut!((*block).collections), snapshot.collections);
+            ptr::write_volatile(ptr::addr_of_mut!((*block).collected), snapshot.collected);
+            ptr::write_volatile(ptr::addr_of_mut!((*block).promotions), snapshot.promotions);
+            ptr::write_volatile(
+                ptr::addr_of_mut!((*block).pause_buckets),
+                snapshot.pause_buckets,
+            );
+            ptr::write_volatile(
+                ptr::addr_of_mut!((*block).total_pause_us),
+                snapshot.total_pause_us,
+            );
+            ptr::write_volatile(ptr::addr_of_mut!((*block).max_pause_us), snapshot.max_pause_us);
+            (*block).seq.fetch_add(1, Ordering::AcqRel);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_stats_shm_roundtrip() {
+        let name = format!("/python_gc_stats_test_{}", std::process::id());
+        shm::open(&name).unwrap();
+        // Second open while one is active is rejected.
+        assert!(shm::open(&name).is_err());
+
+        CollectionTelemetry::global().record_collection(1, 5, Duration::from_micros(10));
+
+        // Attach a second, independent mapping the way an external scraper
+        // would and run the seqlock read protocol against it.
+        unsafe {
+            let c_name = std::ffi::CString::new(name.clone()).unwrap();
+            let fd = libc::shm_open(c_name.as_ptr(), libc::O_RDONLY, 0);
+            assert!(fd >= 0);
+            let size = std::mem::size_of::<shm::StatsShmBlock>();
+            let addr = libc::mmap(
+                std::ptr::null_mut(),
+                size,
+                libc::PROT_READ,
+                libc::MAP_SHARED,
+                fd,
+                0,
+            );
+            libc::close(fd);
+            assert_ne!(addr, libc::MAP_FAILED);
+
+            let block = addr as *const shm::StatsShmBlock;
+            let (seq, collections) = loop {
+                let before = (*block).seq.load(std::sync::atomic::Ordering::Acquire);
+                if before % 2 == 1 {
+                    continue;
+                }
+                let collections = std::ptr::read_volatile(std::ptr::addr_of!((*block).collections));
+                let after = (*block).seq.load(std::sync::atomic::Ordering::Acquire);
+                if before == after {
+                    break (after, collections);
+                }
+            };
+
+            assert!(seq >= 2, "publish never ran");
+            assert!(collections[1] >= 1);
+
+            libc::munmap(addr, size);
+            shm::close();
+            libc::shm_unlink(c_name.as_ptr());
+        }
+    }
+
+    #[test]
+    fn test_record_collection() {
+        let telemetry = CollectionTelemetry::default();
+
+        telemetry.record_collection(0, 42, Duration::from_micros(100));
+        telemetry.record_collection(0, 8, Duration::from_micros(3));
+        telemetry.record_collection(2, 1, Duration::from_millis(2));
+
+        let snapshot = telemetry.snapshot();
+        assert_eq!(snapshot.collections[0], 2);
+        assert_eq!(snapshot.collected[0], 50);
+        assert_eq!(snapshot.collections[2], 1);
+        assert_eq!(snapshot.total_pause_us, 2103);
+        assert_eq!(snapshot.max_pause_us, 2000);
+        assert_eq!(snapshot.pause_buckets.iter().sum::<u64>(), 3);
+    }
+
+    #[test]
+    fn test_pause_bucket_tail() {
+        let telemetry = CollectionTelemetry::default();
+
+        // Far beyond the last power-of-two bucket: lands in the tail.
+        telemetry.record_collection(1, 0, Duration::from_secs(60));
+
+        let snapshot = telemetry.snapshot();
+        assert_eq!(snapshot.pause_buckets[PAUSE_BUCKET_COUNT - 1], 1);
+    }
+}
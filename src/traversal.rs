@@ -1,29 +1,154 @@
 use crate::GCResult;
 use crate::error::GCError;
 use crate::object::{ObjectId, PyObject};
-use std::collections::{HashMap, HashSet, VecDeque};
+use std::collections::{HashMap, HashSet};
 
-#[derive(Debug, Clone)]
-pub struct Reference {
-    pub from: ObjectId,
-    pub to: ObjectId,
-    pub reference_type: ReferenceType,
-}
-
-#[derive(Debug, Clone, PartialEq)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum ReferenceType {
     Direct,
     Weak,
     Finalizer,
 }
 
+/// Packed edge: the target object id shifted up two bits with the
+/// `ReferenceType` in the low 2-bit tag. One word per edge, instead of the
+/// old `Reference` struct repeating `from`, `to`, and an enum discriminant.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+struct Edge(usize);
+
+const EDGE_TAG_DIRECT: usize = 0;
+const EDGE_TAG_WEAK: usize = 1;
+const EDGE_TAG_FINALIZER: usize = 2;
+const EDGE_TAG_MASK: usize = 0x3;
+
+impl Edge {
+    fn new(to: ObjectId, ref_type: ReferenceType) -> Self {
+        let tag = match ref_type {
+            ReferenceType::Direct => EDGE_TAG_DIRECT,
+            ReferenceType::Weak => EDGE_TAG_WEAK,
+            ReferenceType::Finalizer => EDGE_TAG_FINALIZER,
+        };
+        Self((to.as_usize() << 2) | tag)
+    }
+
+    fn target(self) -> ObjectId {
+        ObjectId { id: self.0 >> 2 }
+    }
+}
+
+/// Edges stored inline before spilling to the heap. Our object graphs
+/// average degree ~2.7, so almost every adjacency list fits here.
+const EDGE_INLINE_CAP: usize = 4;
+
+/// Small-degree-optimized adjacency list: up to [`EDGE_INLINE_CAP`] packed
+/// edges live in the enum payload itself, and only genuinely wide nodes pay
+/// for a heap vector.
+#[derive(Debug, Clone)]
+enum EdgeList {
+    Inline { len: u8, edges: [Edge; EDGE_INLINE_CAP] },
+    Spilled(Vec<Edge>),
+}
+
+impl Default for EdgeList {
+    fn default() -> Self {
+        Self::Inline {
+            len: 0,
+            edges: [Edge(0); EDGE_INLINE_CAP],
+        }
+    }
+}
+
+impl EdgeList {
+    fn push(&mut self, edge: Edge) {
+        match self {
+            Self::Inline { len, edges } => {
+                if (*len as usize) < EDGE_INLINE_CAP {
+                    edges[*len as usize] = edge;
+                    *len += 1;
+                } else {
+                    let mut spilled = Vec::with_capacity(EDGE_INLINE_CAP * 2);
+                    spilled.extend_from_slice(edges);
+                    spilled.push(edge);
+                    *self = Self::Spilled(spilled);
+                }
+            }
+            Self::Spilled(edges) => edges.push(edge),
+        }
+    }
+
+    /// Drop every edge pointing at `to`, compacting in place.
+    fn remove_target(&mut self, to: &ObjectId) {
+        match self {
+            Self::Inline { len, edges } => {
+                let mut kept = 0u8;
+                for i in 0..*len as usize {
+                    if edges[i].target() != *to {
+                        edges[kept as usize] = edges[i];
+                        kept += 1;
+                    }
+                }
+                *len = kept;
+            }
+            Self::Spilled(edges) => edges.retain(|edge| edge.target() != *to),
+        }
+    }
+
+    fn len(&self) -> usize {
+        match self {
+            Self::Inline { len, .. } => *len as usize,
+            Self::Spilled(edges) => edges.len(),
+        }
+    }
+
+    fn iter(&self) -> impl Iterator<Item = Edge> + '_ {
+        match self {
+            Self::Inline { len, edges } => edges[..*len as usize].iter().copied(),
+            Self::Spilled(edges) => edges[..].iter().copied(),
+        }
+    }
+}
+
+/// Compressed-sparse-row view of the graph, built in two passes immediately
+/// before a traversal: nodes get dense `u32` indices, each node's out-edges
+/// occupy one contiguous run of `targets`, and every entry keeps its 2-bit
+/// edge-type tag in the low bits. Marking then streams flat `u32` arrays
+/// instead of chasing hash-map buckets per node.
+#[derive(Debug)]
+pub struct CsrGraph {
+    nodes: Vec<ObjectId>,
+    index: HashMap<ObjectId, u32>,
+    offsets: Vec<u32>,
+    targets: Vec<u32>,
+}
+
+impl CsrGraph {
+    pub fn node_count(&self) -> usize {
+        self.nodes.len()
+    }
+
+    pub fn edge_count(&self) -> usize {
+        self.targets.len()
+    }
+
+    fn index_of(&self, obj_id: &ObjectId) -> Option<u32> {
+        self.index.get(obj_id).copied()
+    }
+
+    /// The packed out-edges of dense node `node`: `target_index << 2 | tag`.
+    fn edges(&self, node: u32) -> &[u32] {
+        &self.targets[self.offsets[node as usize] as usize..self.offsets[node as usize + 1] as usize]
+    }
+}
+
 #[derive(Debug)]
 pub struct ObjectGraph {
     objects: HashMap<ObjectId, PyObject>,
 
-    references: HashMap<ObjectId, Vec<Reference>>,
+    references: HashMap<ObjectId, EdgeList>,
 
-    reverse_references: HashMap<ObjectId, Vec<ObjectId>>,
+    /// Referrer ids per object (stored as tag-less packed edges), so
+    /// `remove_object` walks exactly the lists that mention the victim.
+    reverse_references: HashMap<ObjectId, EdgeList>,
 }
 
 impl ObjectGraph {
@@ -38,20 +163,26 @@ impl ObjectGraph {
     pub fn add_object(&mut self, obj: PyObject) {
         let obj_id = obj.id;
         self.objects.insert(obj_id, obj);
-        self.references.insert(obj_id, Vec::new());
-        self.reverse_references.insert(obj_id, Vec::new());
+        self.references.insert(obj_id, EdgeList::default());
+        self.reverse_references.insert(obj_id, EdgeList::default());
     }
 
     pub fn remove_object(&mut self, obj_id: &ObjectId) -> Option<PyObject> {
-        if let Some(refs) = self.reverse_references.remove(obj_id) {
-            for from_id in refs {
-                if let Some(from_refs) = self.references.get_mut(&from_id) {
-                    from_refs.retain(|r| r.to != *obj_id);
+        if let Some(referrers) = self.reverse_references.remove(obj_id) {
+            for referrer in referrers.iter() {
+                if let Some(from_edges) = self.references.get_mut(&referrer.target()) {
+                    from_edges.remove_target(obj_id);
                 }
             }
         }
 
-        self.references.remove(obj_id);
+        if let Some(edges) = self.references.remove(obj_id) {
+            for edge in edges.iter() {
+                if let Some(reverse) = self.reverse_references.get_mut(&edge.target()) {
+                    reverse.remove_target(obj_id);
+                }
+            }
+        }
 
         self.objects.remove(obj_id)
     }
@@ -66,26 +197,43 @@ impl ObjectGraph {
             return Err(GCError::Internal("Object not found in graph".to_string()));
         }
 
-        let reference = Reference {
-            from,
-            to,
-            reference_type: ref_type,
-        };
+        self.references
+            .entry(from)
+            .or_default()
+            .push(Edge::new(to, ref_type));
+
+        self.reverse_references
+            .entry(to)
+            .or_default()
+            .push(Edge::new(from, ReferenceType::Direct));
 
-        self.references.entry(from).or_default().push(reference);
+        Ok(())
+    }
 
-        self.reverse_references.entry(to).or_default().push(from);
+    /// Add `Direct` edges from a container object to every child handle in
+    /// its payload. The children must already be in the graph; this is how
+    /// handle-based `ObjectData::List`/`Dict` payloads become graph edges.
+    pub fn link_children(&mut self, obj_id: &ObjectId) -> GCResult<()> {
+        let children = self
+            .objects
+            .get(obj_id)
+            .ok_or(GCError::Internal("Object not found in graph".to_string()))?
+            .data
+            .children();
 
+        for child in children {
+            self.add_reference(*obj_id, child, ReferenceType::Direct)?;
+        }
         Ok(())
     }
 
     pub fn remove_reference(&mut self, from: ObjectId, to: ObjectId) -> GCResult<()> {
-        if let Some(refs) = self.references.get_mut(&from) {
-            refs.retain(|r| r.to != to);
+        if let Some(edges) = self.references.get_mut(&from) {
+            edges.remove_target(&to);
         }
 
-        if let Some(reverse_refs) = self.reverse_references.get_mut(&to) {
-            reverse_refs.retain(|&id| id != from);
+        if let Some(reverse) = self.reverse_references.get_mut(&to) {
+            reverse.remove_target(&from);
         }
 
         Ok(())
@@ -94,41 +242,194 @@ impl ObjectGraph {
     pub fn get_referrers(&self, obj_id: &ObjectId) -> Vec<&PyObject> {
         self.reverse_references
             .get(obj_id)
-            .map(|refs| refs.iter().filter_map(|id| self.objects.get(id)).collect())
+            .map(|referrers| {
+                referrers
+                    .iter()
+                    .filter_map(|edge| self.objects.get(&edge.target()))
+                    .collect()
+            })
             .unwrap_or_default()
     }
 
     pub fn get_references(&self, obj_id: &ObjectId) -> Vec<&PyObject> {
         self.references
             .get(obj_id)
-            .map(|refs| {
-                refs.iter()
-                    .filter_map(|r| self.objects.get(&r.to))
+            .map(|edges| {
+                edges
+                    .iter()
+                    .filter_map(|edge| self.objects.get(&edge.target()))
                     .collect()
             })
             .unwrap_or_default()
     }
 
+    /// Build the CSR form of the current graph: one pass to count degrees
+    /// and prefix-sum the offsets, one to fill the packed target array.
+    pub fn build_csr(&self) -> CsrGraph {
+        let nodes: Vec<ObjectId> = self.objects.keys().copied().collect();
+        let index: HashMap<ObjectId, u32> = nodes
+            .iter()
+            .enumerate()
+            .map(|(i, id)| (*id, i as u32))
+            .collect();
+
+        let mut offsets = vec![0u32; nodes.len() + 1];
+        for (i, node) in nodes.iter().enumerate() {
+            let degree = self.references.get(node).map(EdgeList::len).unwrap_or(0);
+            offsets[i + 1] = offsets[i] + degree as u32;
+        }
+
+        let mut targets = vec![0u32; offsets[nodes.len()] as usize];
+        let mut cursor = offsets.clone();
+        for (i, node) in nodes.iter().enumerate() {
+            if let Some(edges) = self.references.get(node) {
+                for edge in edges.iter() {
+                    let target = index[&edge.target()];
+                    targets[cursor[i] as usize] = (target << 2) | (edge.0 & EDGE_TAG_MASK) as u32;
+                    cursor[i] += 1;
+                }
+            }
+        }
+
+        CsrGraph {
+            nodes,
+            index,
+            offsets,
+            targets,
+        }
+    }
+
     pub fn find_reachable(&self, roots: &[ObjectId]) -> HashSet<ObjectId> {
-        let mut reachable = HashSet::new();
-        let mut queue = VecDeque::new();
+        let csr = self.build_csr();
+
+        let mut reachable: HashSet<ObjectId> = roots.iter().copied().collect();
+        let mut visited = vec![false; csr.node_count()];
+        let mut stack: Vec<u32> = Vec::new();
 
         for root_id in roots {
-            reachable.insert(*root_id);
-            queue.push_back(*root_id);
+            if let Some(node) = csr.index_of(root_id) {
+                if !visited[node as usize] {
+                    visited[node as usize] = true;
+                    stack.push(node);
+                }
+            }
         }
 
-        while let Some(current_id) = queue.pop_front() {
-            if let Some(refs) = self.references.get(&current_id) {
-                for reference in refs {
-                    if !reachable.contains(&reference.to) {
-                        reachable.insert(reference.to);
-                        queue.push_back(reference.to);
-                    }
+        while let Some(node) = stack.pop() {
+            for &packed in csr.edges(node) {
+                // Weak edges do not keep their target alive.
+                if packed as usize & EDGE_TAG_MASK == EDGE_TAG_WEAK {
+                    continue;
+                }
+                let target = packed >> 2;
+                if !visited[target as usize] {
+                    visited[target as usize] = true;
+                    stack.push(target);
+                }
+            }
+        }
+
+        for (i, seen) in visited.iter().enumerate() {
+            if *seen {
+                reachable.insert(csr.nodes[i]);
+            }
+        }
+        reachable
+    }
+
+    /// Parallel variant of [`find_reachable`](Self::find_reachable): the CSR
+    /// builds once up front, marking runs on `workers` threads with
+    /// per-worker crossbeam deques and work stealing over dense `u32` node
+    /// indices, and the visited set is an atomic bitmap, so large graphs mark
+    /// at memory bandwidth rather than hash-probe speed.
+    pub fn find_reachable_parallel(&self, roots: &[ObjectId], workers: usize) -> HashSet<ObjectId> {
+        use crossbeam::deque::{Injector, Steal, Worker};
+        use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+
+        let workers = workers.max(1);
+        let csr = self.build_csr();
+
+        let bitmap: Vec<AtomicU64> = (0..=csr.node_count() / 64)
+            .map(|_| AtomicU64::new(0))
+            .collect();
+
+        // Returns true the first time a given dense index is marked.
+        let visit = |node: u32| -> bool {
+            let bit = 1u64 << (node % 64);
+            bitmap[node as usize / 64].fetch_or(bit, Ordering::Relaxed) & bit == 0
+        };
+
+        let injector = Injector::new();
+        let pending = AtomicUsize::new(0);
+
+        for root_id in roots {
+            if let Some(node) = csr.index_of(root_id) {
+                if visit(node) {
+                    pending.fetch_add(1, Ordering::Relaxed);
+                    injector.push(node);
                 }
             }
         }
 
+        let locals: Vec<Worker<u32>> = (0..workers).map(|_| Worker::new_fifo()).collect();
+        let stealers: Vec<_> = locals.iter().map(|w| w.stealer()).collect();
+
+        std::thread::scope(|scope| {
+            for local in locals {
+                let stealers = &stealers;
+                let injector = &injector;
+                let pending = &pending;
+                let visit = &visit;
+                let csr = &csr;
+
+                scope.spawn(move || {
+                    loop {
+                        let task = local.pop().or_else(|| {
+                            std::iter::repeat_with(|| {
+                                injector.steal().or_else(|| {
+                                    stealers
+                                        .iter()
+                                        .map(|s| s.steal())
+                                        .collect::<Steal<u32>>()
+                                })
+                            })
+                            .find(|steal| !steal.is_retry())
+                            .and_then(|steal| steal.success())
+                        });
+
+                        match task {
+                            Some(node) => {
+                                for &packed in csr.edges(node) {
+                                    // Weak edges do not keep their target alive.
+                                    if packed as usize & EDGE_TAG_MASK == EDGE_TAG_WEAK {
+                                        continue;
+                                    }
+                                    let target = packed >> 2;
+                                    if visit(target) {
+                                        pending.fetch_add(1, Ordering::Relaxed);
+                                        local.push(target);
+                                    }
+                                }
+                                pending.fetch_sub(1, Ordering::Release);
+                            }
+                            None => {
+                                if pending.load(Ordering::Acquire) == 0 {
+                                    break;
+                                }
+                                std::thread::yield_now();
+                            }
+                        }
+                    }
+                });
+            }
+        });
+
+        let mut reachable: HashSet<ObjectId> = roots.iter().copied().collect();
+        for (i, node_id) in csr.nodes.iter().enumerate() {
+            if bitmap[i / 64].load(Ordering::Relaxed) & (1u64 << (i % 64)) != 0 {
+                reachable.insert(*node_id);
+            }
+        }
         reachable
     }
 
@@ -139,56 +440,91 @@ impl ObjectGraph {
         all_objects.difference(&reachable).copied().collect()
     }
 
+    /// Report reference cycles as strongly connected components.
+    ///
+    /// Iterative Tarjan over the CSR form: the DFS runs on an explicit frame
+    /// stack with dense index/lowlink arrays and edge iteration is a cursor
+    /// into one contiguous `u32` run per node, so arbitrarily deep object
+    /// chains (e.g. long linked lists) cannot overflow the thread stack and
+    /// per-node state is array indexing instead of HashSet probing. Only
+    /// components that actually form a cycle are returned: size > 1, or a
+    /// single node with a self edge.
     pub fn detect_cycles(&self) -> Vec<Vec<ObjectId>> {
+        const UNVISITED: u32 = u32::MAX;
+
+        let csr = self.build_csr();
+        let node_count = csr.node_count();
+
+        let mut index = vec![UNVISITED; node_count];
+        let mut lowlink = vec![0u32; node_count];
+        let mut on_stack = vec![false; node_count];
+        let mut scc_stack: Vec<u32> = Vec::new();
+        let mut next_index: u32 = 0;
+
+        // (node, next edge to examine) frames replacing native recursion.
+        let mut frames: Vec<(u32, usize)> = Vec::new();
         let mut cycles = Vec::new();
-        let mut visited = HashSet::new();
-        let mut rec_stack = HashSet::new();
-
-        for obj_id in self.objects.keys() {
-            if !visited.contains(obj_id) {
-                let mut path = Vec::new();
-                self.dfs_cycle_detection(
-                    *obj_id,
-                    &mut visited,
-                    &mut rec_stack,
-                    &mut path,
-                    &mut cycles,
-                );
+
+        for start in 0..node_count as u32 {
+            if index[start as usize] != UNVISITED {
+                continue;
             }
-        }
 
-        cycles
-    }
+            index[start as usize] = next_index;
+            lowlink[start as usize] = next_index;
+            next_index += 1;
+            scc_stack.push(start);
+            on_stack[start as usize] = true;
+            frames.push((start, 0));
+
+            while let Some(&mut (v, ref mut cursor)) = frames.last_mut() {
+                let edge = csr.edges(v).get(*cursor).copied();
+
+                if let Some(packed) = edge {
+                    *cursor += 1;
+                    let w = packed >> 2;
+
+                    if index[w as usize] == UNVISITED {
+                        index[w as usize] = next_index;
+                        lowlink[w as usize] = next_index;
+                        next_index += 1;
+                        scc_stack.push(w);
+                        on_stack[w as usize] = true;
+                        frames.push((w, 0));
+                    } else if on_stack[w as usize] {
+                        lowlink[v as usize] = lowlink[v as usize].min(index[w as usize]);
+                    }
+                } else {
+                    frames.pop();
+
+                    if let Some(&mut (parent, _)) = frames.last_mut() {
+                        lowlink[parent as usize] = lowlink[parent as usize].min(lowlink[v as usize]);
+                    }
 
-    fn dfs_cycle_detection(
-        &self,
-        current_id: ObjectId,
-        visited: &mut HashSet<ObjectId>,
-        rec_stack: &mut HashSet<ObjectId>,
-        path: &mut Vec<ObjectId>,
-        cycles: &mut Vec<Vec<ObjectId>>,
-    ) {
-        visited.insert(current_id);
-        rec_stack.insert(current_id);
-        path.push(current_id);
-
-        if let Some(refs) = self.references.get(&current_id) {
-            for reference in refs {
-                let next_id = reference.to;
-
-                if !visited.contains(&next_id) {
-                    self.dfs_cycle_detection(next_id, visited, rec_stack, path, cycles);
-                } else if rec_stack.contains(&next_id) {
-                    if let Some(cycle_start) = path.iter().position(|&id| id == next_id) {
-                        let cycle: Vec<ObjectId> = path[cycle_start..].to_vec();
-                        cycles.push(cycle);
+                    if lowlink[v as usize] == index[v as usize] {
+                        let mut component = Vec::new();
+                        loop {
+                            let w = scc_stack.pop().expect("SCC stack underflow");
+                            on_stack[w as usize] = false;
+                            component.push(csr.nodes[w as usize]);
+                            if w == v {
+                                break;
+                            }
+                        }
+
+                        let is_cycle = component.len() > 1
+                            || csr.edges(v).iter().any(|&packed| packed >> 2 == v);
+
+                        if is_cycle {
+                            component.reverse();
+                            cycles.push(component);
+                        }
                     }
                 }
             }
         }
 
-        rec_stack.remove(&current_id);
-        path.pop();
+        cycles
     }
 
     pub fn object_count(&self) -> usize {
@@ -196,7 +532,7 @@ impl ObjectGraph {
     }
 
     pub fn reference_count(&self) -> usize {
-        self.references.values().map(|refs| refs.len()).sum()
+        self.references.values().map(EdgeList::len).sum()
     }
 
     pub fn is_empty(&self) -> bool {
@@ -277,6 +613,111 @@ mod tests {
         assert_eq!(referrers[0].id, id1);
     }
 
+    #[test]
+    fn test_edge_list_spills_past_inline_capacity() {
+        let mut graph = ObjectGraph::new();
+
+        let hub = PyObject::new("hub".to_string(), ObjectData::Integer(0));
+        let hub_id = hub.id;
+        graph.add_object(hub);
+
+        // Twice the inline capacity, so the adjacency list must spill and
+        // keep every edge.
+        let mut spoke_ids = Vec::new();
+        for i in 0..(EDGE_INLINE_CAP * 2) {
+            let spoke = PyObject::new("spoke".to_string(), ObjectData::Integer(i as i64));
+            let spoke_id = spoke.id;
+            spoke_ids.push(spoke_id);
+            graph.add_object(spoke);
+            graph
+                .add_reference(hub_id, spoke_id, ReferenceType::Direct)
+                .unwrap();
+        }
+
+        assert_eq!(graph.reference_count(), EDGE_INLINE_CAP * 2);
+        let reachable = graph.find_reachable(&[hub_id]);
+        assert!(spoke_ids.iter().all(|id| reachable.contains(id)));
+
+        // Removal compacts the spilled list too.
+        graph.remove_reference(hub_id, spoke_ids[0]).unwrap();
+        assert_eq!(graph.reference_count(), EDGE_INLINE_CAP * 2 - 1);
+        assert!(!graph.find_reachable(&[hub_id]).contains(&spoke_ids[0]));
+    }
+
+    #[test]
+    fn test_remove_object_unlinks_both_directions() {
+        let mut graph = ObjectGraph::new();
+
+        let a = PyObject::new("a".to_string(), ObjectData::Integer(1));
+        let b = PyObject::new("b".to_string(), ObjectData::Integer(2));
+        let c = PyObject::new("c".to_string(), ObjectData::Integer(3));
+        let (a_id, b_id, c_id) = (a.id, b.id, c.id);
+
+        graph.add_object(a);
+        graph.add_object(b);
+        graph.add_object(c);
+        graph.add_reference(a_id, b_id, ReferenceType::Direct).unwrap();
+        graph.add_reference(b_id, c_id, ReferenceType::Direct).unwrap();
+
+        graph.remove_object(&b_id);
+
+        assert_eq!(graph.reference_count(), 0);
+        assert!(graph.get_references(&a_id).is_empty());
+        assert!(graph.get_referrers(&c_id).is_empty());
+    }
+
+    #[test]
+    fn test_csr_build_matches_graph() {
+        let mut graph = ObjectGraph::new();
+
+        let a = PyObject::new("a".to_string(), ObjectData::Integer(1));
+        let b = PyObject::new("b".to_string(), ObjectData::Integer(2));
+        let c = PyObject::new("c".to_string(), ObjectData::Integer(3));
+        let (a_id, b_id, c_id) = (a.id, b.id, c.id);
+
+        graph.add_object(a);
+        graph.add_object(b);
+        graph.add_object(c);
+        graph.add_reference(a_id, b_id, ReferenceType::Direct).unwrap();
+        graph.add_reference(a_id, c_id, ReferenceType::Weak).unwrap();
+        graph.add_reference(b_id, c_id, ReferenceType::Direct).unwrap();
+
+        let csr = graph.build_csr();
+        assert_eq!(csr.node_count(), 3);
+        assert_eq!(csr.edge_count(), 3);
+
+        // The weak edge keeps its tag through the packed representation.
+        let a_node = csr.index_of(&a_id).unwrap();
+        let weak_edges = csr
+            .edges(a_node)
+            .iter()
+            .filter(|&&packed| packed as usize & EDGE_TAG_MASK == EDGE_TAG_WEAK)
+            .count();
+        assert_eq!(weak_edges, 1);
+    }
+
+    #[test]
+    fn test_link_children_creates_edges() {
+        let mut graph = ObjectGraph::new();
+
+        let child1 = PyObject::new("int".to_string(), ObjectData::Integer(1));
+        let child2 = PyObject::new("int".to_string(), ObjectData::Integer(2));
+        let id1 = child1.id;
+        let id2 = child2.id;
+
+        let list = PyObject::new("list".to_string(), ObjectData::List(vec![id1, id2]));
+        let list_id = list.id;
+
+        graph.add_object(child1);
+        graph.add_object(child2);
+        graph.add_object(list);
+        graph.link_children(&list_id).unwrap();
+
+        let reachable = graph.find_reachable(&[list_id]);
+        assert!(reachable.contains(&id1));
+        assert!(reachable.contains(&id2));
+    }
+
     #[test]
     fn test_find_reachable() {
         let mut graph = ObjectGraph::new();
@@ -307,6 +748,71 @@ mod tests {
         assert!(reachable.contains(&id3));
     }
 
+    #[test]
+    fn test_find_reachable_parallel_matches_sequential() {
+        let mut graph = ObjectGraph::new();
+        let mut ids = Vec::new();
+
+        for i in 0..100 {
+            let obj = PyObject::new(format!("obj{i}"), ObjectData::Integer(i));
+            ids.push(obj.id);
+            graph.add_object(obj);
+        }
+
+        // A chain with some cross edges, plus a disconnected tail.
+        for window in ids[..80].windows(2) {
+            graph
+                .add_reference(window[0], window[1], ReferenceType::Direct)
+                .unwrap();
+        }
+        graph
+            .add_reference(ids[10], ids[40], ReferenceType::Direct)
+            .unwrap();
+        graph
+            .add_reference(ids[79], ids[0], ReferenceType::Direct)
+            .unwrap();
+
+        let roots = [ids[0]];
+        let sequential = graph.find_reachable(&roots);
+        let parallel = graph.find_reachable_parallel(&roots, 4);
+
+        assert_eq!(sequential, parallel);
+    }
+
+    #[test]
+    fn test_weak_edges_do_not_keep_objects_alive() {
+        let mut graph = ObjectGraph::new();
+
+        let root = PyObject::new("root".to_string(), ObjectData::Integer(0));
+        let strong = PyObject::new("strong".to_string(), ObjectData::Integer(1));
+        let weak = PyObject::new("weak".to_string(), ObjectData::Integer(2));
+
+        let root_id = root.id;
+        let strong_id = strong.id;
+        let weak_id = weak.id;
+
+        graph.add_object(root);
+        graph.add_object(strong);
+        graph.add_object(weak);
+
+        graph
+            .add_reference(root_id, strong_id, ReferenceType::Direct)
+            .unwrap();
+        graph
+            .add_reference(root_id, weak_id, ReferenceType::Weak)
+            .unwrap();
+
+        let reachable = graph.find_reachable(&[root_id]);
+        assert!(reachable.contains(&strong_id));
+        assert!(!reachable.contains(&weak_id));
+
+        let parallel = graph.find_reachable_parallel(&[root_id], 4);
+        assert_eq!(reachable, parallel);
+
+        let unreachable = graph.find_unreachable(&[root_id]);
+        assert!(unreachable.contains(&weak_id));
+    }
+
     #[test]
     fn test_cycle_detection() {
         let mut graph = ObjectGraph::new();
@@ -331,4 +837,51 @@ mod tests {
         assert_eq!(cycles.len(), 1);
         assert_eq!(cycles[0].len(), 2);
     }
+
+    #[test]
+    fn test_cycle_detection_deep_chain() {
+        let mut graph = ObjectGraph::new();
+        let mut ids = Vec::new();
+
+        // Deep enough to overflow the thread stack with recursive DFS.
+        for i in 0..200_000 {
+            let obj = PyObject::new("node".to_string(), ObjectData::Integer(i));
+            ids.push(obj.id);
+            graph.add_object(obj);
+        }
+
+        for window in ids.windows(2) {
+            graph
+                .add_reference(window[0], window[1], ReferenceType::Direct)
+                .unwrap();
+        }
+
+        assert!(graph.detect_cycles().is_empty());
+
+        // Close the tail into a 3-node cycle.
+        let last = ids[ids.len() - 1];
+        graph
+            .add_reference(last, ids[ids.len() - 3], ReferenceType::Direct)
+            .unwrap();
+
+        let cycles = graph.detect_cycles();
+        assert_eq!(cycles.len(), 1);
+        assert_eq!(cycles[0].len(), 3);
+    }
+
+    #[test]
+    fn test_cycle_detection_self_loop() {
+        let mut graph = ObjectGraph::new();
+
+        let obj = PyObject::new("selfref".to_string(), ObjectData::Integer(0));
+        let obj_id = obj.id;
+        graph.add_object(obj);
+        graph
+            .add_reference(obj_id, obj_id, ReferenceType::Direct)
+            .unwrap();
+
+        let cycles = graph.detect_cycles();
+        assert_eq!(cycles.len(), 1);
+        assert_eq!(cycles[0], vec![obj_id]);
+    }
 }
@@ -0,0 +1,164 @@
+/* clock_gettime under -std=c99 */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "../include/python_gc.h"
+
+/*
+ * FFI boundary benchmarks.
+ *
+ * Times the exported functions an embedding application calls on its hot
+ * paths — py_gc_track/py_gc_untrack, py_gc_refcount_changed, and the
+ * automatic-tracking hooks py_gc_object_created/py_gc_object_destroyed —
+ * over millions of calls and prints ns/op. The monotonic clock is read once
+ * per phase, not per call, so timer overhead is amortized to nothing.
+ *
+ * Run via `make bench-ffi`.
+ */
+
+/* The library imports these Python C API symbols for its PyList-based entry
+ * points and is linked with eager binding, so they must resolve at load time
+ * even though this harness never calls those paths. The stubs are exported
+ * back to the library via --export-dynamic. */
+void Py_IncRef(void* obj) { (void)obj; }
+void Py_DecRef(void* obj) { (void)obj; }
+void* PyList_New(long size) { (void)size; return NULL; }
+long PyList_Size(void* list) { (void)list; return -1; }
+void* PyList_GetItem(void* list, long index) {
+    (void)list;
+    (void)index;
+    return NULL;
+}
+int PyList_SetItem(void* list, long index, void* item) {
+    (void)list;
+    (void)index;
+    (void)item;
+    return -1;
+}
+
+/* Distinct objects cycled through per phase; each phase runs the whole pool
+ * ROUNDS times. */
+#define POOL_SIZE (1 << 20)
+#define ROUNDS 4
+
+/* Matches the PyObject_HEAD layout the automatic-tracking hooks read. A null
+ * ob_type makes the type-name probe fall back to "unknown" instead of
+ * dereferencing garbage. */
+typedef struct {
+    size_t ob_refcnt;
+    void* ob_type;
+} mock_object_t;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void report(const char* name, uint64_t elapsed_ns, size_t calls) {
+    printf("%-28s %10.1f ns/op  (%zu calls, %.1f ms total)\n", name,
+           (double)elapsed_ns / (double)calls, calls,
+           (double)elapsed_ns / 1e6);
+}
+
+static mock_object_t* make_pool(void) {
+    mock_object_t* pool = calloc(POOL_SIZE, sizeof(mock_object_t));
+    if (!pool) {
+        fprintf(stderr, "failed to allocate object pool\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < POOL_SIZE; i++) {
+        pool[i].ob_refcnt = 1;
+        pool[i].ob_type = NULL;
+    }
+    return pool;
+}
+
+static void bench_track_untrack(mock_object_t* pool) {
+    uint64_t track_ns = 0;
+    uint64_t untrack_ns = 0;
+
+    for (int round = 0; round < ROUNDS; round++) {
+        uint64_t start = now_ns();
+        for (size_t i = 0; i < POOL_SIZE; i++) {
+            py_gc_track(&pool[i]);
+        }
+        track_ns += now_ns() - start;
+
+        start = now_ns();
+        for (size_t i = 0; i < POOL_SIZE; i++) {
+            py_gc_untrack(&pool[i]);
+        }
+        untrack_ns += now_ns() - start;
+    }
+
+    report("py_gc_track", track_ns, (size_t)ROUNDS * POOL_SIZE);
+    report("py_gc_untrack", untrack_ns, (size_t)ROUNDS * POOL_SIZE);
+}
+
+static void bench_refcount_changed(mock_object_t* pool) {
+    /* Deltas buffer in a thread-local ring, so this measures the common
+     * (no-flush) path; the explicit flush drains whatever is left. */
+    py_gc_track(&pool[0]);
+
+    const size_t calls = (size_t)ROUNDS * POOL_SIZE;
+    uint64_t start = now_ns();
+    for (size_t i = 0; i < calls; i++) {
+        py_gc_refcount_changed(&pool[0], (int32_t)(i & 0xFF) + 1,
+                               (int32_t)(i & 0xFF) + 2);
+    }
+    py_gc_flush_refcount_deltas();
+    uint64_t elapsed = now_ns() - start;
+
+    py_gc_untrack(&pool[0]);
+    report("py_gc_refcount_changed", elapsed, calls);
+}
+
+static void bench_object_lifecycle(mock_object_t* pool) {
+    uint64_t created_ns = 0;
+    uint64_t destroyed_ns = 0;
+
+    py_gc_enable_automatic_tracking();
+
+    for (int round = 0; round < ROUNDS; round++) {
+        uint64_t start = now_ns();
+        for (size_t i = 0; i < POOL_SIZE; i++) {
+            py_gc_object_created(&pool[i]);
+        }
+        created_ns += now_ns() - start;
+
+        start = now_ns();
+        for (size_t i = 0; i < POOL_SIZE; i++) {
+            py_gc_object_destroyed(&pool[i]);
+        }
+        destroyed_ns += now_ns() - start;
+    }
+
+    py_gc_disable_automatic_tracking();
+
+    report("py_gc_object_created", created_ns, (size_t)ROUNDS * POOL_SIZE);
+    report("py_gc_object_destroyed", destroyed_ns, (size_t)ROUNDS * POOL_SIZE);
+}
+
+int main(void) {
+    if (py_gc_init() != GC_SUCCESS) {
+        fprintf(stderr, "py_gc_init failed\n");
+        return 1;
+    }
+
+    mock_object_t* pool = make_pool();
+
+    printf("FFI boundary benchmarks (%d x %d objects per phase)\n\n", ROUNDS,
+           POOL_SIZE);
+    bench_track_untrack(pool);
+    bench_refcount_changed(pool);
+    bench_object_lifecycle(pool);
+
+    free(pool);
+    py_gc_cleanup();
+    return 0;
+}